@@ -0,0 +1,33 @@
+#pragma once
+#include "frame_reader.h"
+
+// Vector ASC logs as exported by CANalyzer and CANoe:
+//   date Wed Apr 17 10:00:00.000 am 2024
+//   base hex  timestamps absolute
+//   Begin Triggerblock Wed Apr 17 10:00:00.000 am 2024
+//      0.012345 1  123             Rx   d 8 01 02 03 04 05 06 07 08
+//      0.013210 1  18FEF100x       Rx   d 8 FF FF FF 00 00 FF FF FF
+//      0.014000 1  7DF             Tx   r
+//      0.020000 1  ErrorFrame
+//   End TriggerBlock
+// "base dec" switches IDs and data bytes to decimal, "timestamps relative"
+// makes every timestamp relative to the previous line. CAN FD, statistics
+// and event lines are skipped.
+
+// True if the start of the stream looks like an ASC header
+bool isAscLog(const char* data, size_t n);
+
+class AscReader : public FrameReader
+{
+public:
+    using FrameReader::FrameReader;
+    bool next(CanFrame& frame) override;
+    const char* name() const override { return "asc"; }
+
+private:
+    bool parseMessage(const char* p, const char* end, CanFrame& frame);
+
+    uint8_t base = 16;
+    bool relative = false;
+    int64_t lastTimestamp = 0;
+};
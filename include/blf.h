@@ -0,0 +1,60 @@
+#pragma once
+#include "frame_reader.h"
+#ifdef ARDUINO
+#include <esp32/rom/miniz.h>
+#endif
+
+// Vector binary logging format (.blf). The file starts with a "LOGG" header
+// followed by "LOBJ" objects; current writers put all objects into log
+// container objects whose payload is zlib compressed. Containers are
+// inflated one at a time with the ROM tinfl decoder (zlib on the host) into
+// PSRAM and their contents parsed as one continuous object stream, since
+// objects may straddle two containers. CAN_MESSAGE and CAN_MESSAGE2 objects
+// become frames, everything else is skipped.
+
+#define BLF_FILE_MAGIC "LOGG"
+#define BLF_OBJECT_MAGIC "LOBJ"
+#define BLF_CAN_MESSAGE 1
+#define BLF_LOG_CONTAINER 10
+#define BLF_CAN_MESSAGE2 86
+
+#ifndef BLF_MAX_CONTAINER
+#define BLF_MAX_CONTAINER 131072 // uncompressed container size of Vector tools
+#endif
+
+// Container payloads of the outer object stream, inflated
+class BlfContainerSource : public LogSource
+{
+public:
+    explicit BlfContainerSource(BlockBuffer* outer) : outer(outer) {}
+    ~BlfContainerSource() override;
+    bool begin();
+    size_t read(uint8_t* buf, size_t n) override;
+    const char* name() const override { return "blf"; }
+
+private:
+    bool nextContainer();
+
+    BlockBuffer* outer;
+#ifdef ARDUINO
+    tinfl_decompressor* inflator = nullptr;
+#endif
+    uint8_t* in = nullptr;
+    uint8_t* out = nullptr;
+    size_t pos = 0;
+    size_t len = 0;
+};
+
+class BlfReader : public FrameReader
+{
+public:
+    using FrameReader::FrameReader;
+    ~BlfReader() override;
+    bool begin();
+    bool next(CanFrame& frame) override;
+    const char* name() const override { return "blf"; }
+
+private:
+    BlfContainerSource* containers = nullptr;
+    BlockBuffer* objects = nullptr;
+};
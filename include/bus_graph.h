@@ -0,0 +1,31 @@
+#pragma once
+#include <stdint.h>
+
+// Sweeping graph at the bottom of the status screen: bus load in percent
+// (green) and, in replay mode, the mean replay timing error (red), one
+// column per GRAPH_SAMPLE_MS. The screen holds the history: each update
+// draws the step from the previous sample into the next column and moves a
+// grey erase bar one column ahead of it, pushing just those two
+// 1 x GRAPH_HEIGHT columns (128 bytes) over the SPI bus the display shares
+// with the MCP2515.
+
+#ifndef GRAPH_SAMPLE_MS
+#define GRAPH_SAMPLE_MS 100
+#endif
+
+#ifndef GRAPH_ERROR_FULL_US
+#define GRAPH_ERROR_FULL_US 2000 // timing error at the top of the graph
+#endif
+
+#define GRAPH_WIDTH 320
+#define GRAPH_HEIGHT 32
+
+struct GraphSample
+{
+    uint8_t loadPercent;
+    uint16_t timingErrorUs; // mean absolute error, 0 in record mode
+};
+
+void initBusGraph(int16_t y);
+// Take one sample from the counters and draw it, every GRAPH_SAMPLE_MS
+void updateBusGraph();
@@ -0,0 +1,8 @@
+#pragma once
+#include <mcp_can.h>
+#include "hw_filter.h"
+
+// MCP2515 on the COMMU module, shared by the replay and record paths
+extern MCP_CAN CAN0;
+
+bool initCAN(const HwFilterPlan* plan);
@@ -0,0 +1,30 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Frame flags, matching the candump notation
+#define CAN_FRAME_EXT 0x01 // 29-bit identifier
+#define CAN_FRAME_RTR 0x02 // remote transmission request
+#define CAN_FRAME_ERR 0x04 // error frame
+
+// mcp_can encodes the frame type in the upper bits of the identifier
+#define MCP_ID_EXT 0x80000000UL
+#define MCP_ID_RTR 0x40000000UL
+
+struct CanFrame
+{
+    int64_t timestampUs; // microseconds, since boot when recorded
+    uint32_t id;
+    uint8_t len;
+    uint8_t flags;
+    uint8_t data[8];
+};
+
+inline void frameFromMcpId(unsigned long mcpId, CanFrame& frame)
+{
+    frame.flags = 0;
+    if (mcpId & MCP_ID_EXT) frame.flags |= CAN_FRAME_EXT;
+    if (mcpId & MCP_ID_RTR) frame.flags |= CAN_FRAME_RTR;
+    frame.id = mcpId & ((frame.flags & CAN_FRAME_EXT) ? 0x1FFFFFFFUL : 0x7FFUL);
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <Arduino.h>
+
+// CAN ID list loaded from the SD card, in the format of tools/canids.txt:
+// one hex ID per line, blank lines and lines starting with '#' are ignored.
+// IDs above 0x7FF or written with more than three digits are extended.
+// Without a list every frame is accepted.
+//
+// accepts() is constant time: standard IDs test one bit of a 2048-bit
+// bitmap, extended IDs go through a perfect hash built at load time
+// (hash-and-displace: a first hash picks a bucket, the bucket's
+// displacement seeds a second hash that lands on a slot holding only that
+// ID). Both the replay and the record path filter through it.
+
+#ifndef CAN_ID_FILE
+#define CAN_ID_FILE "/canids.txt"
+#endif
+
+#ifndef CAN_ID_MAX
+#define CAN_ID_MAX 512 // per ID type
+#endif
+
+class CanIdFilter
+{
+public:
+    bool load(const char* path);
+    bool enabled() const { return active; }
+
+    bool accepts(uint32_t id, bool ext) const
+    {
+        if (!active) return true;
+        if (!ext) return stdBitmap[(id >> 5) & 63] & (1UL << (id & 31));
+        if (!extCount) return false;
+        uint32_t bucket = hashId(id, 0) & bucketMask;
+        return hashTable[hashId(id, displacement[bucket]) & slotMask] == id;
+    }
+
+    // Sorted ID lists, used to plan the MCP2515 acceptance filters
+    const uint32_t* standardIds() const { return stdIds; }
+    size_t standardCount() const { return stdCount; }
+    const uint32_t* extendedIds() const { return extIds; }
+    size_t extendedCount() const { return extCount; }
+
+private:
+    static uint32_t hashId(uint32_t id, uint32_t seed)
+    {
+        // murmur3 finalizer
+        uint32_t h = id ^ (seed * 0x9E3779B9UL);
+        h ^= h >> 16;
+        h *= 0x85EBCA6BUL;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35UL;
+        h ^= h >> 16;
+        return h;
+    }
+    bool buildHash();
+
+    bool active = false;
+    uint32_t stdBitmap[64] = {}; // one bit per 11-bit ID
+    uint32_t stdIds[CAN_ID_MAX];
+    uint32_t extIds[CAN_ID_MAX];
+    size_t stdCount = 0;
+    size_t extCount = 0;
+
+    uint32_t* hashTable = nullptr;     // extended ID per slot, empty slots hold 0xFFFFFFFF
+    uint16_t* displacement = nullptr;  // per bucket
+    uint32_t slotMask = 0;
+    uint32_t bucketMask = 0;
+};
+
+extern CanIdFilter idFilter;
@@ -0,0 +1,20 @@
+#pragma once
+#include "can_frame.h"
+#include "config.h"
+
+// Replay transmit path. Frames are loaded straight into the MCP2515
+// transmit buffer 0 with one LOAD TX BUFFER burst (ID registers including
+// EID8/EID0, DLC with the RTR bit, data) followed by RTS, so standard,
+// extended and remote frames cost the same few SPI bytes. Only buffer 0 is
+// used: the controller sends equal priority buffers highest number first,
+// which would reorder the log. Instead of waiting for each frame to leave,
+// the next call waits for TXREQ to clear, which overlaps the bus time of a
+// frame with the inter-frame delay of the replay.
+
+#ifndef CAN_TX_TIMEOUT_US
+#define CAN_TX_TIMEOUT_US 2000 // wait for the previous frame to leave
+#endif
+
+// Returns CAN_OK, or CAN_GETTXBFTIMEOUT while the previous frame is still
+// pending (bus busy or no ACK)
+uint8_t transmitFrame(const CanFrame& frame);
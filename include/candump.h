@@ -0,0 +1,21 @@
+#pragma once
+#include "can_frame.h"
+
+// Longest line produced by formatCandump, including the newline
+#define CANDUMP_MAX_LINE 64
+
+// Format a frame as one candump log line:
+//   (1713351000.000000) can0 123#0102030405060708\n
+// Returns the number of characters written, no terminator is added.
+size_t formatCandump(const CanFrame& frame, char* out);
+
+// Hex digit value, -1 for anything else. Shared by the text log parsers.
+extern const int8_t hexValue[256];
+
+// Parse one candump log line (without the newline) of the form
+//   (1713351000.000000) can0 123#0102030405060708
+// Any interface name is accepted. IDs with more than three digits are
+// extended, or error frames when CAN_ERR_FLAG (0x20000000) is set; "#R" and
+// "#R4" are remote frames. Returns false for lines that do not match,
+// including CAN FD ("##") frames.
+bool parseCandump(const char* line, const char* end, CanFrame& frame);
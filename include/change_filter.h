@@ -0,0 +1,49 @@
+#pragma once
+#include "log_writer.h"
+
+// Change-only recording: a frame is stored only when its payload differs
+// from the last stored payload of the same ID, or when that ID has not been
+// stored for CHANGE_MAX_INTERVAL_MS. In addition every CHANGE_KEYFRAME_MS
+// starts a keyframe period in which the first frame of every ID is stored,
+// so the bus state at any point can be rebuilt from the log by holding each
+// ID's last value, starting from any keyframe.
+//
+// Last values live in a fixed open-addressing table in internal RAM. IDs
+// that do not fit are passed through unfiltered.
+
+#ifndef CHANGE_TABLE_SIZE
+#define CHANGE_TABLE_SIZE 1024 // power of two
+#endif
+
+#ifndef CHANGE_MAX_INTERVAL_MS
+#define CHANGE_MAX_INTERVAL_MS 1000 // 0 disables the per-ID interval
+#endif
+
+#ifndef CHANGE_KEYFRAME_MS
+#define CHANGE_KEYFRAME_MS 10000
+#endif
+
+class ChangeFilter : public LogWriter
+{
+public:
+    explicit ChangeFilter(LogWriter* sink) : sink(sink) {}
+    bool begin() override;
+    void write(const CanFrame& frame) override;
+    void flush() override { sink->flush(); }
+    void end() override;
+
+private:
+    struct Entry
+    {
+        uint32_t key; // id | type bits, 0 = free slot
+        uint32_t lastMs;
+        uint16_t keyframe;
+        uint8_t len;
+        uint8_t data[8];
+    };
+
+    Entry* lookup(uint32_t key);
+
+    LogWriter* sink;
+    Entry* table = nullptr; // CHANGE_TABLE_SIZE entries, internal RAM
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+// Build-time configuration. Every value below can be overridden with a
+// -D flag in the build_flags section of platformio.ini.
+
+#ifndef BUFFER_SIZE
+#define BUFFER_SIZE 512 // SD write buffer, one sector
+#endif
+
+#ifndef QUEUE_SIZE
+#define QUEUE_SIZE 500 // frames buffered between the SD and the CAN task
+#endif
+
+#ifndef CAN0_INT
+#define CAN0_INT 15 // MCP2515 interrupt pin
+#endif
+
+#ifndef CAN_BITRATE
+#define CAN_BITRATE 500000 // bus speed, matches CAN_500KBPS in initCAN()
+#endif
+
+#ifndef BOOT_TARGET_MS
+#define BOOT_TARGET_MS 1500 // time to first frame, slower boots are reported
+#endif
+
+#ifndef CAN0_CS
+#define CAN0_CS 12 // MCP2515 chip select
+#endif
+
+// Output format used in record mode
+#define LOG_FORMAT_CANDUMP 0 // candump text, one file per session
+#define LOG_FORMAT_FLIGHT 1  // fixed-size ring file, see flight_recorder.h
+#define LOG_FORMAT_LZ4 2     // candump text in an LZ4 frame, see lz4_writer.h
+#define LOG_FORMAT_DELTA 3   // compact binary, see delta_log.h
+#define LOG_FORMAT_PCAPNG 4  // Wireshark capture, see pcapng.h
+#define LOG_FORMAT_MF4 5     // ASAM MDF4 bus logging, see mdf4.h
+
+#ifndef LOG_FORMAT
+#define LOG_FORMAT LOG_FORMAT_CANDUMP
+#endif
+
+// Buffer frames in PSRAM and only write them around a trigger event,
+// see trigger_capture.h
+#ifndef LOG_TRIGGER
+#define LOG_TRIGGER 0
+#endif
+
+// Only store frames whose payload changed, see change_filter.h
+#ifndef LOG_CHANGE_ONLY
+#define LOG_CHANGE_ONLY 0
+#endif
+
+// Directory on the SD card that receives recordings. Replay only looks at
+// files in the root directory, so recordings are never picked up as input.
+#ifndef LOG_DIR
+#define LOG_DIR "/rec"
+#endif
+
+#ifndef LOG_SYNC_MS
+#define LOG_SYNC_MS 1000 // upper bound on data lost at power cut
+#endif
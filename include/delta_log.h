@@ -0,0 +1,71 @@
+#pragma once
+#include "frame_reader.h"
+#ifdef ARDUINO
+#include "log_writer.h"
+#endif
+
+// Compact binary log (.cdl). After an 8 byte header
+//   "CDL1" | version | 0 | dictionary capacity (uint16 LE)
+// every frame is one record:
+//   varint  timestamp delta in microseconds to the previous record
+//   varint  key = index << 2 | NEW_ID << 1 | NEW_LEN
+//   [varint id | flags << 29]  if NEW_ID: defines dictionary entry index
+//   [byte   len]               if NEW_LEN: length differs from the last one
+//   byte    mask of payload bytes that changed
+//   bytes   payload XOR previous payload of this ID, changed bytes only
+// Varints are LEB128. IDs enter the dictionary on first use, so writing and
+// reading are both single pass; the decoder only keeps the last length and
+// payload per dictionary entry. Once the dictionary is full, new IDs are
+// written with index == capacity and coded against an all-zero payload.
+
+#define DELTA_MAGIC "CDL1"
+#define DELTA_HEADER_SIZE 8
+#define DELTA_MAX_RECORD 32
+#define DELTA_KEY_NEW_ID 0x02
+#define DELTA_KEY_NEW_LEN 0x01
+
+#ifndef DELTA_MAX_IDS
+#define DELTA_MAX_IDS 1024 // power of two
+#endif
+
+struct DeltaEntry
+{
+    uint32_t key; // id | flags << 29, 0xFFFFFFFF = unused
+    uint8_t len;
+    uint8_t data[8];
+};
+
+#ifdef ARDUINO
+class DeltaWriter : public LogWriter
+{
+public:
+    bool begin() override;
+    void write(const CanFrame& frame) override;
+    void flush() override;
+    void end() override;
+
+private:
+    File file;
+    char buffer[BUFFER_SIZE];
+    size_t used = 0;
+    int64_t lastTimestamp = 0;
+    DeltaEntry* entries = nullptr; // by dictionary index
+    uint16_t* slots = nullptr;     // hash of key -> index + 1
+    uint16_t count = 0;
+};
+#endif
+
+class DeltaReader : public FrameReader
+{
+public:
+    using FrameReader::FrameReader;
+    ~DeltaReader() override { free(entries); }
+    bool begin();
+    bool next(CanFrame& frame) override;
+    const char* name() const override { return "delta"; }
+
+private:
+    DeltaEntry* entries = nullptr;
+    uint16_t capacity = 0;
+    int64_t timestamp = 0;
+};
@@ -0,0 +1,72 @@
+#pragma once
+#include "log_writer.h"
+
+// Flight recorder: a fixed-size ring file that always holds the most recent
+// traffic. The file is created once at full size and afterwards only
+// overwritten in place, so no file is created or grown while recording and
+// write latency does not drift as the card fills up.
+//
+// The file is a ring of FLIGHT_BLOCK_SIZE blocks. Every block starts with a
+// FlightBlockHeader followed by whole candump lines; the rest is zero padded.
+// Sequence numbers grow by one per block, so the newest block is the last one
+// before the sequence drops, found with a binary search at start-up.
+//
+// A new file is only extended, not written, so its blocks may still hold
+// those of a deleted ring. Each file has a random epoch, written at once to
+// block 0 and to every block after it; blocks of another epoch count as
+// never written.
+// tools/flight_extract.py turns the ring back into an ordered candump log.
+
+#ifndef FLIGHT_FILE_PATH
+#define FLIGHT_FILE_PATH LOG_DIR "/flight.bin"
+#endif
+
+#ifndef FLIGHT_FILE_MB
+#define FLIGHT_FILE_MB 128
+#endif
+
+#ifndef FLIGHT_BLOCK_SIZE
+#define FLIGHT_BLOCK_SIZE 4096 // multiple of the 512 byte sector
+#endif
+
+#ifndef FLIGHT_SYNC_BLOCKS
+#define FLIGHT_SYNC_BLOCKS 16
+#endif
+
+#define FLIGHT_MAGIC 0x32425246UL // "FRB2"
+
+struct FlightBlockHeader
+{
+    uint32_t magic;
+    uint32_t epoch;    // that of block 0 in every block of the current ring
+    uint32_t sequence; // 0 marks a block that was never written
+    uint16_t used;     // payload bytes after the header
+    uint16_t frames;
+    uint32_t check;    // magic ^ epoch ^ sequence ^ (used << 16 | frames)
+};
+
+class FlightRecorder : public LogWriter
+{
+public:
+    bool begin() override;
+    void write(const CanFrame& frame) override;
+    void flush() override;
+    void end() override;
+
+private:
+    bool openRing();
+    bool create();
+    void locateHead();
+    uint32_t readSequence(uint32_t block);
+    void writeBlock();
+
+    File file;
+    uint8_t* block = nullptr;
+    uint32_t blockCount = 0;
+    uint32_t epoch = 0;
+    uint32_t index = 0;    // block currently being filled
+    uint32_t sequence = 1; // sequence number of that block
+    size_t used = 0;
+    uint16_t frames = 0;
+    uint32_t unsynced = 0;
+};
@@ -0,0 +1,167 @@
+#pragma once
+#include <algorithm>
+#include "can_frame.h"
+#include "log_source.h"
+#include "stage_profiler.h"
+#include "trace_buffer.h"
+
+#ifndef REPLAY_BLOCK_SIZE
+#define REPLAY_BLOCK_SIZE 4096 // parser block, a multiple of the sector size
+#endif
+
+#ifndef REPLAY_MAX_LINE
+#define REPLAY_MAX_LINE 128 // longest line or record a parser needs in one piece
+#endif
+
+#define BLOCK_BUFFER_CAPACITY (REPLAY_MAX_LINE + REPLAY_BLOCK_SIZE)
+
+// Reports of the readers about files they cannot replay, a ReaderEvent
+// and its argument; sent as telemetry on the device, printed on the host
+#include "telemetry.h"
+#ifdef ARDUINO
+#define READER_EVENT(event, arg) telemetryEvent(EVENT_READER, event, arg)
+#else
+#include <stdio.h>
+#define READER_EVENT(event, arg) printf("reader event %d, %ld\n", (int)(event), (long)(arg))
+#endif
+
+// Block buffer over a LogSource. Parsers work on [pos, end) directly and
+// call fill() when a line or record crosses the end: the unread tail moves
+// to the front and the next block is read in behind it. Decompressing
+// sources return short reads, so the tail may grow past REPLAY_MAX_LINE;
+// reads are capped to the room left and ensure() holds up to
+// BLOCK_BUFFER_CAPACITY bytes.
+struct BlockBuffer
+{
+    explicit BlockBuffer(LogSource* source) : source(source) {}
+
+    // Read more data, false when the source has nothing left
+    bool fill()
+    {
+        size_t carry = end - pos;
+        memmove(data, pos, carry);
+        pos = data;
+        end = data + carry;
+        size_t room = BLOCK_BUFFER_CAPACITY - carry;
+        if (room == 0) return false;
+        size_t n = readSource((uint8_t*)end, std::min(room, (size_t)REPLAY_BLOCK_SIZE));
+        end += n;
+        return n > 0;
+    }
+
+    // Make at least want bytes available if the source still has them,
+    // returns the number available; 0 if want exceeds the capacity
+    size_t ensure(size_t want)
+    {
+        if (want > BLOCK_BUFFER_CAPACITY) return 0;
+        while ((size_t)(end - pos) < want && fill())
+        {
+        }
+        return end - pos;
+    }
+
+    // Next line without its line ending, false at the end of the stream.
+    // Overlong lines are dropped up to and including their newline.
+    bool nextLine(const char*& line, const char*& lineEnd)
+    {
+        bool dropping = false;
+        while (true)
+        {
+            char* nl = (char*)memchr(pos, '\n', end - pos);
+            if (!nl)
+            {
+                if (end - pos > REPLAY_MAX_LINE)
+                {
+                    pos = end;
+                    dropping = true;
+                }
+                if (fill()) continue;
+                if (pos == end) return false;
+                nl = end; // last line without a newline
+            }
+            if (dropping)
+            {
+                // The rest of the overlong line
+                pos = nl < end ? nl + 1 : nl;
+                dropping = false;
+                continue;
+            }
+
+            line = pos;
+            lineEnd = nl;
+            if (lineEnd > line && lineEnd[-1] == '\r') lineEnd--;
+            pos = nl < end ? nl + 1 : nl;
+            return true;
+        }
+    }
+
+    // Copy n bytes out, large reads go straight from the source. Returns
+    // the number copied, less than n at the end of the stream.
+    size_t take(uint8_t* dst, size_t n)
+    {
+        size_t k = std::min((size_t)(end - pos), n);
+        memcpy(dst, pos, k);
+        pos += k;
+        while (k < n)
+        {
+            size_t got = readSource(dst + k, n - k);
+            if (got == 0) break;
+            k += got;
+        }
+        return k;
+    }
+
+    // Discard n bytes, false if the stream ends first
+    bool skip(size_t n)
+    {
+        while (n > 0)
+        {
+            if (pos == end && !fill()) return false;
+            size_t k = std::min((size_t)(end - pos), n);
+            pos += k;
+            n -= k;
+        }
+        return true;
+    }
+
+    // Source read, timed as the read stage of the stage profile and traced
+    size_t readSource(uint8_t* dst, size_t n)
+    {
+        TRACE(TRACE_SD_READ_BEGIN, n);
+#if PROFILE_STAGES
+        // Buffers stacked on buffers (BLF containers) time the outer read only
+        static uint8_t depth = 0;
+        STAGE_START(t);
+        depth++;
+        size_t got = source->read(dst, n);
+        if (--depth == 0) STAGE_END(STAGE_READ, t);
+#else
+        size_t got = source->read(dst, n);
+#endif
+        TRACE(TRACE_SD_READ_END, got);
+        return got;
+    }
+
+    LogSource* source;
+    char data[BLOCK_BUFFER_CAPACITY];
+    char* pos = data;
+    char* end = data;
+};
+
+// Turns the byte stream of a log into frames
+class FrameReader
+{
+public:
+    explicit FrameReader(BlockBuffer* buffer) : buffer(buffer) {}
+    virtual ~FrameReader() { delete buffer; }
+    // Next frame of the log, false at the end
+    virtual bool next(CanFrame& frame) = 0;
+    virtual const char* name() const = 0;
+
+protected:
+    BlockBuffer* buffer;
+};
+
+// Look at the start of the stream and pick the parser for its format,
+// NULL if the header of a binary format is damaged
+FrameReader* openFrameReader(LogSource* source);
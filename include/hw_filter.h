@@ -0,0 +1,19 @@
+#pragma once
+#include "can_id_filter.h"
+
+// MCP2515 acceptance filter plan. RXB0 has one mask and two filters, RXB1
+// one mask and four filters; a filter accepts every ID that equals it in all
+// bits set in its buffer's mask. The plan covers every listed ID and keeps
+// the number of other IDs let through as small as the heuristic can find.
+struct HwFilterPlan
+{
+    bool ext[2];       // ID type handled by RXB0 / RXB1
+    uint32_t mask[2];
+    uint32_t filter[6]; // 0-1 belong to RXB0, 2-5 to RXB1
+    uint64_t accepted;  // IDs the hardware lets through
+};
+
+void planHardwareFilter(const CanIdFilter& filter, HwFilterPlan& plan);
+
+// Program the plan into CAN0, which must have been started in MCP_STDEXT mode
+void applyHardwareFilter(const HwFilterPlan& plan);
@@ -0,0 +1,22 @@
+#pragma once
+#include <stdint.h>
+
+// Histogram over the whole 32 bit range with four buckets per power of two,
+// so a percentile read from it is within 25 % of the true value; min, max
+// and sum are kept exactly. Written by one task, read by any.
+
+#define LOG_HISTOGRAM_BUCKETS 128
+
+struct LogHistogram
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t buckets[LOG_HISTOGRAM_BUCKETS];
+
+    void record(uint32_t value);
+    // Upper edge of the bucket holding the given quantile in per mille
+    // (990 = p99), capped at max; 0 when empty
+    uint32_t quantile(uint16_t perMille) const;
+};
@@ -0,0 +1,36 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Byte stream the replay reader parses from. openLogSource() sniffs the first
+// bytes of the file and stacks a streaming decompressor on top when the log
+// is gzip (.log.gz) or LZ4 (.lz4) compressed, so archived captures replay
+// straight from the card. Decompressor state and windows live in PSRAM and
+// have a fixed size, whatever the length of the file.
+
+#ifndef SOURCE_READ_SIZE
+#define SOURCE_READ_SIZE 4096 // compressed bytes fetched from SD at a time
+#endif
+
+// Largest LZ4 block replayed: lz4 -B4 (64 KB) and -B5 (256 KB). The lz4
+// default -B7 needs 4 MB blocks, which with their input buffer and the
+// history do not fit in the mapped 4 MB of PSRAM; such files are rejected.
+#ifndef LZ4_SOURCE_MAX_BLOCK
+#define LZ4_SOURCE_MAX_BLOCK 262144
+#endif
+
+class LogSource
+{
+public:
+    virtual ~LogSource() {}
+    // Fill up to n bytes, returns 0 at the end of the stream
+    virtual size_t read(uint8_t* buf, size_t n) = 0;
+    virtual const char* name() const = 0;
+};
+
+#ifdef ARDUINO
+#include <SD.h>
+
+// Caller owns the returned source, NULL if the stream cannot be decoded
+LogSource* openLogSource(File& file);
+#endif
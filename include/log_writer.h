@@ -0,0 +1,43 @@
+#pragma once
+#include <SD.h>
+#include "can_frame.h"
+#include "config.h"
+
+// Sink for received frames. Only the writer task calls into a LogWriter, so
+// implementations need no locking.
+class LogWriter
+{
+public:
+    virtual ~LogWriter() {}
+    virtual bool begin() = 0;
+    virtual void write(const CanFrame& frame) = 0;
+    // Push buffered data to the card, called every LOG_SYNC_MS and when idle
+    virtual void flush() = 0;
+    virtual void end() = 0;
+};
+
+// Plain candump text, one numbered file per session in LOG_DIR. Output is
+// collected in a sector-sized buffer so the card only sees whole-sector writes,
+// apart from the tail synced in place by flush().
+class CandumpWriter : public LogWriter
+{
+public:
+    bool begin() override;
+    void write(const CanFrame& frame) override;
+    void flush() override;
+    void end() override;
+
+private:
+    File file;
+    char buffer[BUFFER_SIZE];
+    size_t used = 0;
+};
+
+// Open the first unused LOG_DIR/<prefix>NNNN<ext> for writing
+File openNextLogFile(const char* prefix, const char* ext);
+
+// Flushes the file with the partial sector of a BUFFER_SIZE buffer written
+// behind it, then moves the position back to the start of that sector, so
+// the next full-sector write replaces it and every write stays sector
+// aligned. The caller keeps the tail in its buffer.
+void syncSectorTail(File& file, const char* buffer, size_t used);
@@ -0,0 +1,27 @@
+#pragma once
+#include <Arduino.h>
+
+// Minimal LZ4 (https://github.com/lz4/lz4) block codec and frame helpers,
+// enough to write .lz4 files the reference tools read back.
+
+#define LZ4_FRAME_MAGIC 0x184D2204UL
+#define LZ4_FRAME_HEADER_SIZE 7
+#define LZ4_UNCOMPRESSED_BIT 0x80000000UL // block size flag: stored as is
+#define LZ4_HASH_ENTRIES 4096
+
+// Worst case output of lz4Compress for n input bytes
+#define LZ4_COMPRESS_BOUND(n) ((n) + (n) / 255 + 16)
+
+// Compress one independent block of at most 64 KB into dst, which must hold
+// LZ4_COMPRESS_BOUND(n) bytes. table is scratch space of LZ4_HASH_ENTRIES.
+size_t lz4Compress(const uint8_t* src, size_t n, uint8_t* dst, uint16_t* table);
+
+// Frame header for independent blocks of up to 64 KB without checksums
+void lz4FrameHeader(uint8_t header[LZ4_FRAME_HEADER_SIZE]);
+
+uint32_t xxh32(const uint8_t* data, size_t n, uint32_t seed);
+
+// Decode one block into dst. Matches may reach back before dst down to
+// history, which lets linked blocks refer to the previous 64 KB. Returns the
+// decoded size, or -1 for corrupt input or output beyond capacity.
+int32_t lz4Decompress(const uint8_t* src, size_t n, uint8_t* dst, size_t capacity, const uint8_t* history);
@@ -0,0 +1,33 @@
+#pragma once
+#include "log_writer.h"
+#include "lz4.h"
+
+// Candump text compressed on the fly into an LZ4 frame (can_NNNN.log.lz4,
+// readable with the lz4 command line tool). Lines are formatted straight
+// into an LZ4_BLOCK_SIZE input block; every full block, and every partial
+// block at flush(), is compressed and written as an independent,
+// length-prefixed LZ4 block, so a power cut loses at most the block in
+// flight. A file cut short has no end mark, `lz4 -d` still decodes every
+// complete block before reporting the truncation.
+
+#ifndef LZ4_BLOCK_SIZE
+#define LZ4_BLOCK_SIZE 16384 // at most 65536
+#endif
+
+class Lz4CandumpWriter : public LogWriter
+{
+public:
+    bool begin() override;
+    void write(const CanFrame& frame) override;
+    void flush() override;
+    void end() override;
+
+private:
+    void writeBlock();
+
+    File file;
+    uint8_t* in = nullptr;
+    uint8_t* out = nullptr;
+    uint16_t* table = nullptr;
+    size_t used = 0;
+};
@@ -0,0 +1,637 @@
+#pragma once
+#include <stdint.h>
+
+// Generated by tools/logo_compress.py from m5_logo.h, do not edit.
+// 320x240 RGB565, 10012 bytes run-length coded from 153600.
+
+#define LOGO_WIDTH 320
+#define LOGO_HEIGHT 240
+
+const uint8_t gImage_logoM5_rle[10012] = {
+    0xFF, 0xEF, 0x7D, 0xFF, 0xEF, 0x7D, 0xBD, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x06,
+    0xC7, 0x7F, 0x66, 0x9F, 0x2E, 0x1F, 0x25, 0xFF, 0x4E, 0x5F, 0x8E, 0xFF, 0xEF, 0xDF, 0xFF, 0xFF,
+    0xFF, 0x98, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x97, 0xFF, 0xFF, 0x05, 0xBF, 0x5F,
+    0x3E, 0x3F, 0x05, 0x9F, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x02, 0x0D, 0xBF,
+    0x6E, 0x9F, 0xDF, 0xBF, 0xFF, 0xFF, 0xFF, 0x96, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0x95, 0xFF, 0xFF, 0x02, 0xB7, 0x3F, 0x3E, 0x3F, 0x05, 0xBF, 0x87, 0x05, 0x9F, 0x02, 0x05, 0xBF,
+    0x56, 0x7F, 0xC7, 0x7F, 0xFF, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0x93, 0xFF, 0xFF, 0x01, 0xA7, 0x3F, 0x2E, 0x1F, 0x87, 0x05, 0x9F, 0x02, 0x05, 0xBF, 0x05, 0x9F,
+    0x05, 0xBF, 0x81, 0x05, 0x9F, 0x01, 0x36, 0x1F, 0xA7, 0x3F, 0xFF, 0xFF, 0xFF, 0x92, 0xFF, 0xFF,
+    0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0x02, 0x9F, 0x1F, 0x25, 0xFF, 0x05, 0xBF,
+    0x84, 0x05, 0x9F, 0x07, 0x36, 0x1F, 0x8E, 0xFF, 0xB7, 0x5F, 0xB7, 0x3F, 0x7E, 0xBF, 0x36, 0x3F,
+    0x05, 0x9F, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x04, 0x05, 0xBF, 0x05, 0x9F, 0x1D, 0xFF, 0x8E, 0xFF,
+    0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x8E, 0xFF,
+    0xFF, 0x03, 0xF7, 0xFF, 0x97, 0x1F, 0x1D, 0xFF, 0x05, 0xBF, 0x83, 0x05, 0x9F, 0x02, 0x05, 0xBF,
+    0x5E, 0x7F, 0xD7, 0x9F, 0x84, 0xFF, 0xFF, 0x01, 0xBF, 0x7F, 0x4E, 0x5F, 0x80, 0x05, 0x9F, 0x81,
+    0x05, 0xBF, 0x03, 0x05, 0x9F, 0x0D, 0xBF, 0x76, 0x9F, 0xDF, 0x9F, 0xFF, 0xFF, 0xFF, 0x8D, 0xFF,
+    0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0x8E, 0xFF, 0x1D,
+    0xFF, 0x82, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x01, 0x5E, 0x7F, 0xD7, 0x9F, 0x88,
+    0xFF, 0xFF, 0x02, 0xD7, 0x9F, 0x66, 0x7F, 0x0D, 0xBF, 0x82, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x01,
+    0x56, 0x7F, 0xC7, 0x7F, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0x8A, 0xFF, 0xFF, 0x02, 0xF7, 0xDF, 0x86, 0xDF, 0x15, 0xDF, 0x80, 0x05, 0x9F, 0x06, 0x05, 0xBF,
+    0x05, 0x9F, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x5E, 0x7F, 0xD7, 0x9F, 0x8C, 0xFF, 0xFF, 0x02,
+    0xE7, 0xBF, 0x76, 0xBF, 0x0D, 0xBF, 0x83, 0x05, 0x9F, 0x02, 0x05, 0xBF, 0x3E, 0x1F, 0xAF, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x89, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x02,
+    0xEF, 0xDF, 0x7E, 0xBF, 0x0D, 0xBF, 0x81, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x01,
+    0x66, 0x9F, 0xDF, 0xBF, 0x90, 0xFF, 0xFF, 0x02, 0xF7, 0xDF, 0x86, 0xDF, 0x1D, 0xDF, 0x81, 0x05,
+    0xBF, 0x80, 0x05, 0x9F, 0x03, 0x05, 0xBF, 0x25, 0xFF, 0x8E, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF,
+    0x86, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x86, 0xFF, 0xFF, 0x02, 0xE7, 0xBF, 0x76,
+    0xBF, 0x0D, 0xBF, 0x84, 0x05, 0x9F, 0x02, 0x05, 0xBF, 0x66, 0x9F, 0xE7, 0xBF, 0x95, 0xFF, 0xFF,
+    0x02, 0x9F, 0x1F, 0x25, 0xFF, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x03, 0x05, 0xBF,
+    0x0D, 0xDF, 0x76, 0xBF, 0xE7, 0xBF, 0xFF, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF,
+    0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0x02, 0xDF, 0xBF, 0x6E, 0x9F, 0x0D, 0xBF, 0x84, 0x05, 0x9F, 0x02,
+    0x05, 0xBF, 0x6E, 0x9F, 0xE7, 0xBF, 0x99, 0xFF, 0xFF, 0x03, 0xB7, 0x3F, 0x3E, 0x3F, 0x05, 0x9F,
+    0x05, 0xBF, 0x83, 0x05, 0x9F, 0x01, 0x5E, 0x7F, 0xCF, 0x7F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF,
+    0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0x02, 0xD7, 0x9F, 0x5E, 0x7F, 0x05, 0xBF,
+    0x83, 0x05, 0x9F, 0x03, 0x05, 0xBF, 0x0D, 0xBF, 0x76, 0xBF, 0xE7, 0xDF, 0x9D, 0xFF, 0xFF, 0x02,
+    0xC7, 0x7F, 0x4E, 0x5F, 0x05, 0xBF, 0x84, 0x05, 0x9F, 0x01, 0x3E, 0x3F, 0xAF, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x01, 0xD7, 0x9F,
+    0x56, 0x7F, 0x85, 0x05, 0x9F, 0x02, 0x0D, 0xBF, 0x76, 0xBF, 0xE7, 0xDF, 0xA1, 0xFF, 0xFF, 0x02,
+    0xDF, 0x9F, 0x66, 0x9F, 0x05, 0xBF, 0x84, 0x05, 0x9F, 0x02, 0x25, 0xFF, 0x96, 0xFF, 0xF7, 0xDF,
+    0xFE, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x01, 0xCF, 0x7F, 0x56, 0x5F, 0x82, 0x05,
+    0x9F, 0x00, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x02, 0x0D, 0xBF, 0x7E, 0xBF, 0xEF, 0xDF, 0x8E, 0xFF,
+    0xFF, 0x01, 0xD6, 0xBA, 0xF7, 0xBE, 0x93, 0xFF, 0xFF, 0x02, 0xE7, 0xBF, 0x7E, 0xBF, 0x15, 0xDF,
+    0x81, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x02, 0x15, 0xDF, 0x76, 0xBF, 0xE7, 0xBF,
+    0xFC, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFD, 0xFF, 0xFF, 0x03, 0xBF, 0x7F, 0x46, 0x5F, 0x05, 0x9F,
+    0x05, 0xBF, 0x81, 0x05, 0x9F, 0x04, 0x05, 0xBF, 0x05, 0x9F, 0x15, 0xBF, 0x86, 0xDF, 0xEF, 0xDF,
+    0x8D, 0xFF, 0xFF, 0x01, 0xE7, 0x3C, 0x6B, 0x4D, 0x80, 0x10, 0x82, 0x00, 0xC6, 0x38, 0x95, 0xFF,
+    0xFF, 0x03, 0xF7, 0xDF, 0x8E, 0xFF, 0x1D, 0xDF, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x81, 0x05, 0x9F,
+    0x02, 0x05, 0xBF, 0x5E, 0x7F, 0xCF, 0x9F, 0xFA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFB, 0xFF, 0xFF,
+    0x01, 0xB7, 0x5F, 0x3E, 0x3F, 0x82, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x03, 0x05, 0x9F, 0x15, 0xDF,
+    0x86, 0xDF, 0xEF, 0xDF, 0x8D, 0xFF, 0xFF, 0x01, 0xE7, 0x1C, 0x6B, 0x4D, 0x80, 0x00, 0x20, 0x01,
+    0x63, 0x2C, 0xE7, 0x3C, 0x99, 0xFF, 0xFF, 0x05, 0xA7, 0x1F, 0x2E, 0x1F, 0x05, 0x9F, 0x05, 0xBF,
+    0x05, 0x9F, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x01, 0x3E, 0x3F, 0xAF, 0x3F, 0xF8, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xF9, 0xFF, 0xFF, 0x03, 0xAF, 0x3F, 0x36, 0x1F, 0x05, 0xBF, 0x05, 0x9F, 0x80, 0x05,
+    0xBF, 0x05, 0x05, 0x9F, 0x05, 0xBF, 0x05, 0x9F, 0x15, 0xDF, 0x86, 0xDF, 0xF7, 0xDF, 0x8D, 0xFF,
+    0xFF, 0x01, 0xE7, 0x1C, 0x6B, 0x4D, 0x80, 0x00, 0x20, 0x01, 0x63, 0x2C, 0xDE, 0xFB, 0x9D, 0xFF,
+    0xFF, 0x01, 0xB7, 0x5F, 0x3E, 0x3F, 0x80, 0x05, 0xBF, 0x83, 0x05, 0x9F, 0x02, 0x25, 0xFF, 0x96,
+    0xFF, 0xF7, 0xDF, 0xF5, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xF7, 0xFF, 0xFF, 0x03, 0xA7, 0x1F, 0x2E,
+    0x1F, 0x05, 0x9F, 0x05, 0xBF, 0x83, 0x05, 0x9F, 0x02, 0x15, 0xDF, 0x8E, 0xFF, 0xF7, 0xDF, 0x8D,
+    0xFF, 0xFF, 0x01, 0xE7, 0x1C, 0x63, 0x4D, 0x80, 0x00, 0x20, 0x01, 0x63, 0x2C, 0xDE, 0xFB, 0xA1,
+    0xFF, 0xFF, 0x02, 0xCF, 0x7F, 0x56, 0x7F, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x01, 0x05, 0xBF, 0x05,
+    0x9F, 0x80, 0x05, 0xBF, 0x02, 0x15, 0xDF, 0x7E, 0xBF, 0xE7, 0xBF, 0xF3, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xF5, 0xFF, 0xFF, 0x01, 0x9F, 0x1F, 0x25, 0xFF, 0x80, 0x05, 0xBF, 0x83, 0x05, 0x9F, 0x02,
+    0x1D, 0xDF, 0x8E, 0xFF, 0xF7, 0xFF, 0x8D, 0xFF, 0xFF, 0x01, 0xE7, 0x1C, 0x6B, 0x4C, 0x80, 0x00,
+    0x20, 0x01, 0x63, 0x2C, 0xDE, 0xFB, 0xA5, 0xFF, 0xFF, 0x02, 0xDF, 0xBF, 0x66, 0x9F, 0x0D, 0xBF,
+    0x84, 0x05, 0x9F, 0x02, 0x05, 0xBF, 0x5E, 0x7F, 0xCF, 0x7F, 0xF1, 0xFF, 0xFF, 0x80, 0xEF, 0x7D,
+    0xF2, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0x96, 0xFF, 0x1D, 0xFF, 0x82, 0x05, 0x9F, 0x00, 0x05, 0xBF,
+    0x80, 0x05, 0x9F, 0x01, 0x1D, 0xDF, 0x96, 0xFF, 0x8E, 0xFF, 0xFF, 0x01, 0xDE, 0xFB, 0x63, 0x2C,
+    0x80, 0x00, 0x20, 0x01, 0x63, 0x2C, 0xDE, 0xFB, 0x95, 0xFF, 0xFF, 0x07, 0xE7, 0x3C, 0xD6, 0x9A,
+    0xBD, 0xD7, 0xA5, 0x34, 0x9C, 0xD3, 0xAD, 0x75, 0xC6, 0x18, 0xF7, 0x9E, 0x8A, 0xFF, 0xFF, 0x02,
+    0xEF, 0xBF, 0x7E, 0xDF, 0x15, 0xDF, 0x85, 0x05, 0x9F, 0x01, 0x3E, 0x3F, 0xB7, 0x3F, 0xEF, 0xFF,
+    0xFF, 0x80, 0xEF, 0x7D, 0xF0, 0xFF, 0xFF, 0x02, 0xF7, 0xDF, 0x8E, 0xDF, 0x15, 0xDF, 0x83, 0x05,
+    0x9F, 0x03, 0x05, 0xBF, 0x05, 0x9F, 0x1D, 0xFF, 0x97, 0x1F, 0x8E, 0xFF, 0xFF, 0x01, 0xDE, 0xFB,
+    0x63, 0x0C, 0x80, 0x00, 0x20, 0x01, 0x63, 0x2C, 0xDE, 0xFB, 0x92, 0xFF, 0xFF, 0x04, 0xE7, 0x1C,
+    0xAD, 0x55, 0x73, 0xAE, 0x42, 0x28, 0x10, 0x82, 0x85, 0x00, 0x00, 0x03, 0x00, 0x20, 0x42, 0x28,
+    0x9C, 0xF3, 0xFF, 0xDF, 0x89, 0xFF, 0xFF, 0x02, 0xF7, 0xDF, 0x96, 0xFF, 0x25, 0xFF, 0x81, 0x05,
+    0x9F, 0x00, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x01, 0x36, 0x1F, 0xE7, 0xBF, 0xED, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xEE, 0xFF, 0xFF, 0x02, 0xEF, 0xDF, 0x7E, 0xDF, 0x15, 0xDF, 0x85, 0x05, 0x9F, 0x01,
+    0x25, 0xFF, 0x9F, 0x1F, 0x8E, 0xFF, 0xFF, 0x01, 0xDE, 0xFB, 0x63, 0x2C, 0x80, 0x00, 0x20, 0x01,
+    0x63, 0x2C, 0xE7, 0x1C, 0x91, 0xFF, 0xFF, 0x02, 0xC6, 0x38, 0x7B, 0xCF, 0x29, 0x65, 0x82, 0x00,
+    0x00, 0x03, 0x00, 0x20, 0x21, 0x04, 0x29, 0x65, 0x10, 0x82, 0x85, 0x00, 0x00, 0x02, 0x18, 0xC3,
+    0x7B, 0xEF, 0xE7, 0x1C, 0x8A, 0xFF, 0xFF, 0x01, 0xA7, 0x3F, 0x36, 0x1F, 0x81, 0x05, 0x9F, 0x80,
+    0x05, 0xBF, 0x01, 0x15, 0xDF, 0xD7, 0x9F, 0xED, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xEC, 0xFF, 0xFF,
+    0x02, 0xEF, 0xDF, 0x76, 0xBF, 0x0D, 0xBF, 0x80, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x81, 0x05, 0x9F,
+    0x01, 0x25, 0xFF, 0xA7, 0x1F, 0x8E, 0xFF, 0xFF, 0x01, 0xDE, 0xFB, 0x63, 0x0C, 0x80, 0x00, 0x20,
+    0x01, 0x6B, 0x4D, 0xE7, 0x1C, 0x90, 0xFF, 0xFF, 0x02, 0xDE, 0xDB, 0x6B, 0x6D, 0x10, 0xA2, 0x80,
+    0x00, 0x00, 0x05, 0x10, 0xA2, 0x5A, 0xEB, 0x9C, 0xF3, 0xBD, 0xF7, 0xE7, 0x1C, 0xFF, 0xDF, 0x81,
+    0xFF, 0xFF, 0x02, 0xEF, 0x5D, 0x84, 0x10, 0x21, 0x24, 0x84, 0x00, 0x00, 0x01, 0x00, 0x20, 0xAD,
+    0x55, 0x8B, 0xFF, 0xFF, 0x05, 0xBF, 0x5F, 0x5E, 0x7F, 0x3E, 0x3F, 0x6E, 0x9F, 0x9F, 0x1F, 0xEF,
+    0xDF, 0xEE, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xEA, 0xFF, 0xFF, 0x02, 0xE7, 0xBF, 0x6E, 0xBF, 0x0D,
+    0xBF, 0x80, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x82, 0x05, 0x9F, 0x01, 0x2E, 0x1F, 0xA7, 0x3F, 0x8E,
+    0xFF, 0xFF, 0x05, 0xDE, 0xDB, 0x63, 0x0C, 0x00, 0x00, 0x00, 0x20, 0x63, 0x2C, 0xE7, 0x1C, 0x90,
+    0xFF, 0xFF, 0x01, 0xB5, 0xB6, 0x4A, 0x49, 0x80, 0x00, 0x00, 0x02, 0x31, 0xA6, 0x84, 0x30, 0xCE,
+    0x79, 0x8A, 0xFF, 0xFF, 0x01, 0xCE, 0x59, 0x63, 0x0C, 0x83, 0x00, 0x00, 0x01, 0x10, 0x82, 0xFF,
+    0xDF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE8, 0xFF, 0xFF, 0x01, 0xDF, 0xBF,
+    0x66, 0x9F, 0x81, 0x05, 0xBF, 0x01, 0x05, 0x9F, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x02, 0x05, 0xBF,
+    0x2E, 0x1F, 0xAF, 0x3F, 0x8E, 0xFF, 0xFF, 0x01, 0xDE, 0xDB, 0x63, 0x0C, 0x80, 0x00, 0x20, 0x01,
+    0x6B, 0x4D, 0xE7, 0x1C, 0x90, 0xFF, 0xFF, 0x05, 0xA5, 0x14, 0x29, 0x45, 0x00, 0x00, 0x00, 0x20,
+    0x5A, 0xCB, 0xC6, 0x38, 0x8F, 0xFF, 0xFF, 0x01, 0xCE, 0x59, 0x10, 0x82, 0x81, 0x00, 0x00, 0x01,
+    0x00, 0x20, 0xF7, 0xBE, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE6, 0xFF, 0xFF,
+    0x02, 0xD7, 0x9F, 0x5E, 0x7F, 0x05, 0xBF, 0x84, 0x05, 0x9F, 0x02, 0x05, 0xBF, 0x36, 0x1F, 0xAF,
+    0x3F, 0x8E, 0xFF, 0xFF, 0x05, 0xDE, 0xDB, 0x5A, 0xEB, 0x00, 0x20, 0x00, 0x00, 0x5A, 0xEB, 0xE7,
+    0x1C, 0x90, 0xFF, 0xFF, 0x05, 0xA5, 0x34, 0x29, 0x45, 0x00, 0x00, 0x10, 0x82, 0x7B, 0xEF, 0xE7,
+    0x3C, 0x92, 0xFF, 0xFF, 0x00, 0x52, 0x8A, 0x81, 0x00, 0x00, 0x00, 0x42, 0x08, 0x97, 0xFF, 0xFF,
+    0x03, 0xA7, 0x1F, 0x4E, 0x5F, 0x3E, 0x3F, 0xDF, 0xBF, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4,
+    0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0x5E, 0x7F, 0x05, 0xBF, 0x85, 0x05, 0x9F, 0x01, 0x36, 0x1F, 0xB7,
+    0x5F, 0x8F, 0xFF, 0xFF, 0x00, 0x84, 0x30, 0x82, 0x00, 0x00, 0x02, 0x10, 0xA2, 0x7B, 0xEF, 0xEF,
+    0x7D, 0x8D, 0xFF, 0xFF, 0x05, 0xA5, 0x34, 0x29, 0x45, 0x00, 0x00, 0x10, 0x82, 0x7B, 0xEF, 0xEF,
+    0x7D, 0x93, 0xFF, 0xFF, 0x01, 0xFF, 0xDF, 0x18, 0xE3, 0x81, 0x00, 0x00, 0x00, 0xC6, 0x38, 0x95,
+    0xFF, 0xFF, 0x01, 0x9F, 0x1F, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x7E, 0xBF, 0xE4, 0xFF, 0xFF,
+    0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x76, 0xBF, 0x85, 0x05, 0x9F, 0x01, 0x3E, 0x3F, 0xB7,
+    0x5F, 0x90, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0x6B, 0x6D, 0x08, 0x41, 0x83, 0x00, 0x00, 0x02, 0x08,
+    0x41, 0x73, 0x8E, 0xE7, 0x1C, 0x89, 0xFF, 0xFF, 0x05, 0xAD, 0x55, 0x29, 0x45, 0x00, 0x00, 0x08,
+    0x61, 0x7B, 0xEF, 0xEF, 0x7D, 0x95, 0xFF, 0xFF, 0x00, 0x7B, 0xEF, 0x81, 0x00, 0x00, 0x00, 0x8C,
+    0x71, 0x93, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0x96, 0xFF, 0x1D, 0xDF, 0x83, 0x05, 0x9F, 0x00, 0x4E,
+    0x5F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x66, 0x9F, 0x80, 0x05, 0x9F,
+    0x00, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x01, 0x3E, 0x1F, 0xE7, 0xBF, 0x93, 0xFF, 0xFF, 0x02, 0xE7,
+    0x3C, 0x73, 0xAE, 0x08, 0x61, 0x83, 0x00, 0x00, 0x02, 0x00, 0x20, 0x63, 0x0C, 0xDE, 0xDB, 0x85,
+    0xFF, 0xFF, 0x05, 0xAD, 0x55, 0x29, 0x65, 0x00, 0x00, 0x08, 0x61, 0x7B, 0xEF, 0xEF, 0x7D, 0x96,
+    0xFF, 0xFF, 0x00, 0x94, 0x92, 0x80, 0x00, 0x00, 0x01, 0x00, 0x20, 0x9C, 0xF3, 0x92, 0xFF, 0xFF,
+    0x02, 0xF7, 0xFF, 0x8E, 0xDF, 0x15, 0xDF, 0x85, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF,
+    0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x01, 0xC7, 0x7F, 0x05, 0xBF, 0x83, 0x05, 0x9F, 0x80, 0x05,
+    0xBF, 0x01, 0x5E, 0x7F, 0xD7, 0x9F, 0x93, 0xFF, 0xFF, 0x02, 0xEF, 0x7D, 0x7B, 0xEF, 0x10, 0x82,
+    0x84, 0x00, 0x00, 0x01, 0x52, 0xAA, 0xCE, 0x59, 0x81, 0xFF, 0xFF, 0x05, 0xAD, 0x55, 0x29, 0x65,
+    0x00, 0x00, 0x08, 0x61, 0x7B, 0xEF, 0xEF, 0x7D, 0x97, 0xFF, 0xFF, 0x00, 0x84, 0x30, 0x80, 0x00,
+    0x00, 0x01, 0x08, 0x61, 0xB5, 0xB6, 0x91, 0xFF, 0xFF, 0x02, 0xEF, 0xDF, 0x86, 0xDF, 0x15, 0xDF,
+    0x80, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x83, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xE5, 0xFF, 0xFF, 0x01, 0x97, 0x1F, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x84, 0x05, 0x9F,
+    0x01, 0x4E, 0x5F, 0xC7, 0x7F, 0x93, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x8C, 0x51, 0x10, 0xA2, 0x84,
+    0x00, 0x00, 0x06, 0x42, 0x28, 0x94, 0xB2, 0x29, 0x65, 0x00, 0x00, 0x08, 0x61, 0x7B, 0xCF, 0xEF,
+    0x7D, 0x97, 0xFF, 0xFF, 0x01, 0xDE, 0xFB, 0x42, 0x28, 0x80, 0x00, 0x00, 0x01, 0x39, 0xE7, 0xDE,
+    0xDB, 0x90, 0xFF, 0xFF, 0x02, 0xEF, 0xDF, 0x7E, 0xDF, 0x0D, 0xBF, 0x81, 0x05, 0x9F, 0x00, 0x05,
+    0xBF, 0x83, 0x05, 0x9F, 0x02, 0x05, 0xBF, 0x05, 0x9F, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xE6, 0xFF, 0xFF, 0x02, 0xE7, 0xBF, 0x76, 0xBF, 0x0D, 0xBF, 0x83, 0x05, 0x9F, 0x80, 0x05,
+    0xBF, 0x02, 0x05, 0x9F, 0x3E, 0x3F, 0xB7, 0x5F, 0x93, 0xFF, 0xFF, 0x02, 0xF7, 0xBE, 0x94, 0x92,
+    0x18, 0xE3, 0x84, 0x00, 0x00, 0x02, 0x08, 0x61, 0x7B, 0xCF, 0xEF, 0x7D, 0x97, 0xFF, 0xFF, 0x05,
+    0xFF, 0xDF, 0x94, 0x92, 0x08, 0x61, 0x00, 0x00, 0x08, 0x61, 0x94, 0xB2, 0x90, 0xFF, 0xFF, 0x04,
+    0xE7, 0xBF, 0x76, 0xBF, 0x0D, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x82, 0x05, 0x9F, 0x03, 0x0D, 0xDF,
+    0x7E, 0xDF, 0xEF, 0xDF, 0x1D, 0xDF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xE8, 0xFF, 0xFF, 0x02, 0xEF, 0xDF, 0x86, 0xDF, 0x1D, 0xDF, 0x81, 0x05, 0x9F, 0x00,
+    0x05, 0xBF, 0x82, 0x05, 0x9F, 0x01, 0x2E, 0x1F, 0x9F, 0x1F, 0x93, 0xFF, 0xFF, 0x02, 0xFF, 0xDF,
+    0x9C, 0xF3, 0x21, 0x24, 0x80, 0x00, 0x00, 0x02, 0x08, 0x61, 0x73, 0xAE, 0xEF, 0x5D, 0x97, 0xFF,
+    0xFF, 0x06, 0xFF, 0xDF, 0x9C, 0xD3, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x20, 0x6B, 0x6D, 0xEF, 0x5D,
+    0x8F, 0xFF, 0xFF, 0x02, 0xE7, 0xBF, 0x6E, 0x9F, 0x0D, 0xBF, 0x81, 0x05, 0xBF, 0x81, 0x05, 0x9F,
+    0x02, 0x15, 0xDF, 0x7E, 0xDF, 0xEF, 0xDF, 0x80, 0xFF, 0xFF, 0x00, 0x1D, 0xDF, 0x80, 0x05, 0x9F,
+    0x01, 0x05, 0xBF, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xEB, 0xFF, 0xFF, 0x01, 0x9F,
+    0x1F, 0x2E, 0x1F, 0x80, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x83, 0x05, 0x9F, 0x02, 0x1D, 0xDF, 0x8E,
+    0xFF, 0xF7, 0xDF, 0x93, 0xFF, 0xFF, 0x02, 0xB5, 0x96, 0xBD, 0xF7, 0xF7, 0xBE, 0x97, 0xFF, 0xFF,
+    0x02, 0xFF, 0xDF, 0x9C, 0xF3, 0x21, 0x04, 0x80, 0x00, 0x00, 0x01, 0x52, 0xAA, 0xDE, 0xDB, 0x8F,
+    0xFF, 0xFF, 0x02, 0xDF, 0x9F, 0x66, 0x9F, 0x05, 0xBF, 0x84, 0x05, 0x9F, 0x02, 0x15, 0xDF, 0x86,
+    0xDF, 0xEF, 0xDF, 0x82, 0xFF, 0xFF, 0x00, 0x1D, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xED, 0xFF, 0xFF, 0x01, 0xB7, 0x3F, 0x3E, 0x3F, 0x83, 0x05, 0x9F,
+    0x00, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x02, 0x15, 0xDF, 0x7E, 0xDF, 0xEF, 0xBF, 0xAC, 0xFF, 0xFF,
+    0x01, 0xA5, 0x14, 0x21, 0x04, 0x80, 0x00, 0x00, 0x01, 0x52, 0xAA, 0xD6, 0x9A, 0x8F, 0xFF, 0xFF,
+    0x02, 0xD7, 0x9F, 0x5E, 0x7F, 0x05, 0xBF, 0x84, 0x05, 0x9F, 0x02, 0x15, 0xDF, 0x86, 0xDF, 0xF7,
+    0xDF, 0x84, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF,
+    0x80, 0xEF, 0x7D, 0xEF, 0xFF, 0xFF, 0x02, 0xCF, 0x7F, 0x56, 0x7F, 0x05, 0xBF, 0x85, 0x05, 0x9F,
+    0x02, 0x0D, 0xBF, 0x6E, 0x9F, 0xDF, 0xBF, 0xA8, 0xFF, 0xFF, 0x01, 0xA5, 0x34, 0x21, 0x24, 0x80,
+    0x00, 0x00, 0x01, 0x52, 0x8A, 0xD6, 0x9A, 0x8F, 0xFF, 0xFF, 0x01, 0xCF, 0x7F, 0x56, 0x7F, 0x85,
+    0x05, 0x9F, 0x02, 0x15, 0xDF, 0x86, 0xDF, 0xF7, 0xDF, 0x86, 0xFF, 0xFF, 0x00, 0x1D, 0xFF, 0x81,
+    0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xF1, 0xFF, 0xFF, 0x0C, 0xDF,
+    0xBF, 0x6E, 0x9F, 0x0D, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x05, 0x9F, 0x05,
+    0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x5E, 0x7F, 0xCF, 0x9F, 0xA4, 0xFF, 0xFF, 0x01, 0xA5, 0x34, 0x29,
+    0x45, 0x80, 0x00, 0x00, 0x01, 0x52, 0x8A, 0xCE, 0x79, 0x8F, 0xFF, 0xFF, 0x02, 0xC7, 0x7F, 0x4E,
+    0x5F, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x82, 0x05, 0x9F, 0x02, 0x15, 0xDF, 0x8E, 0xDF, 0xF7, 0xDF,
+    0x88, 0xFF, 0xFF, 0x00, 0x25, 0xDF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xF3, 0xFF, 0xFF, 0x02, 0xEF, 0xDF, 0x7E, 0xDF, 0x15, 0xDF, 0x85, 0x05, 0x9F, 0x02,
+    0x05, 0xBF, 0x46, 0x3F, 0xBF, 0x5F, 0xA0, 0xFF, 0xFF, 0x01, 0xAD, 0x55, 0x29, 0x65, 0x80, 0x00,
+    0x00, 0x01, 0x4A, 0x69, 0xCE, 0x59, 0x8F, 0xFF, 0xFF, 0x03, 0xBF, 0x7F, 0x46, 0x3F, 0x05, 0xBF,
+    0x05, 0x9F, 0x82, 0x05, 0xBF, 0x03, 0x05, 0x9F, 0x15, 0xDF, 0x8E, 0xFF, 0xF7, 0xFF, 0x8A, 0xFF,
+    0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D,
+    0xF5, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0x97, 0x1F, 0x25, 0xFF, 0x86, 0x05, 0x9F, 0x01, 0x36, 0x1F,
+    0xAF, 0x3F, 0x9C, 0xFF, 0xFF, 0x01, 0xAD, 0x75, 0x29, 0x65, 0x80, 0x00, 0x00, 0x01, 0x4A, 0x49,
+    0xCE, 0x59, 0x8F, 0xFF, 0xFF, 0x01, 0xB7, 0x5F, 0x3E, 0x1F, 0x81, 0x05, 0x9F, 0x00, 0x05, 0xBF,
+    0x80, 0x05, 0x9F, 0x03, 0x05, 0xBF, 0x1D, 0xDF, 0x8E, 0xFF, 0xF7, 0xFF, 0x8C, 0xFF, 0xFF, 0x00,
+    0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE5, 0xFF,
+    0xFF, 0x03, 0xD7, 0x9F, 0x76, 0xBF, 0x8E, 0xFF, 0xF7, 0xFF, 0x8D, 0xFF, 0xFF, 0x02, 0xAF, 0x3F,
+    0x36, 0x1F, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x02, 0x05, 0xBF,
+    0x25, 0xFF, 0x96, 0xFF, 0x98, 0xFF, 0xFF, 0x01, 0xB5, 0x96, 0x31, 0x86, 0x80, 0x00, 0x00, 0x01,
+    0x4A, 0x49, 0xCE, 0x59, 0x8F, 0xFF, 0xFF, 0x01, 0xAF, 0x3F, 0x36, 0x3F, 0x84, 0x05, 0x9F, 0x03,
+    0x05, 0xBF, 0x1D, 0xDF, 0x96, 0xFF, 0xF7, 0xFF, 0x8E, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05,
+    0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x01, 0xEF, 0xDF,
+    0x15, 0xBF, 0x80, 0x05, 0x9F, 0x00, 0x2D, 0xFF, 0x8F, 0xFF, 0xFF, 0x01, 0xBF, 0x7F, 0x4E, 0x5F,
+    0x83, 0x05, 0x9F, 0x05, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x15, 0xDF, 0x86, 0xDF, 0xEF, 0xDF,
+    0x94, 0xFF, 0xFF, 0x00, 0xA5, 0x34, 0x80, 0x00, 0x00, 0x01, 0x42, 0x28, 0xC6, 0x38, 0x8F, 0xFF,
+    0xFF, 0x03, 0xA7, 0x3F, 0x2E, 0x1F, 0x05, 0x9F, 0x05, 0xBF, 0x83, 0x05, 0x9F, 0x02, 0x1D, 0xDF,
+    0x96, 0xFF, 0xF7, 0xFF, 0x90, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F,
+    0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0xB7, 0x3F, 0x82, 0x05, 0x9F, 0x00,
+    0xE7, 0xDF, 0x90, 0xFF, 0xFF, 0x02, 0xD7, 0x9F, 0x66, 0x9F, 0x05, 0xBF, 0x85, 0x05, 0x9F, 0x02,
+    0x0D, 0xBF, 0x76, 0xBF, 0xE7, 0xBF, 0x92, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0xBD, 0xF7, 0xEF, 0x7D,
+    0x8F, 0xFF, 0xFF, 0x01, 0x9F, 0x1F, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x80, 0x05,
+    0x9F, 0x02, 0x05, 0xBF, 0x1D, 0xFF, 0x97, 0x1F, 0x93, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05,
+    0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F,
+    0x82, 0x05, 0x9F, 0x00, 0xDF, 0xBF, 0x92, 0xFF, 0xFF, 0x02, 0xE7, 0xBF, 0x76, 0xBF, 0x15, 0xDF,
+    0x81, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x02, 0x05, 0xBF, 0x66, 0x7F, 0xD7, 0x9F,
+    0xA1, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0x97, 0x1F, 0x1D, 0xFF, 0x85, 0x05, 0x9F, 0x01, 0x25, 0xFF,
+    0x9E, 0xFF, 0x95, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF,
+    0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05, 0x9F, 0x00, 0xD7, 0x9F,
+    0x94, 0xFF, 0xFF, 0x02, 0xF7, 0xDF, 0x8E, 0xFF, 0x1D, 0xFF, 0x86, 0x05, 0x9F, 0x01, 0x56, 0x5F,
+    0xC7, 0x7F, 0x9D, 0xFF, 0xFF, 0x02, 0xF7, 0xDF, 0x8E, 0xFF, 0x1D, 0xFF, 0x80, 0x05, 0x9F, 0x00,
+    0x05, 0xBF, 0x82, 0x05, 0x9F, 0x01, 0x25, 0xFF, 0x9F, 0x1F, 0x97, 0xFF, 0xFF, 0x00, 0x25, 0xFF,
+    0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x01,
+    0x9F, 0x1F, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x00, 0xD7, 0x9F, 0x97, 0xFF, 0xFF, 0x02, 0xA7, 0x1F,
+    0x36, 0x1F, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x01, 0x3E, 0x3F,
+    0xB7, 0x3F, 0x99, 0xFF, 0xFF, 0x04, 0xF7, 0xDF, 0x86, 0xDF, 0x15, 0xDF, 0x05, 0x9F, 0x05, 0xBF,
+    0x80, 0x05, 0x9F, 0x04, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x25, 0xFF, 0xA7, 0x1F, 0x99, 0xFF,
+    0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D,
+    0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05, 0x9F, 0x00, 0xD7, 0x9F, 0x99, 0xFF, 0xFF, 0x01,
+    0xB7, 0x5F, 0x46, 0x3F, 0x84, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x01, 0x2E, 0x1F, 0x9F, 0x1F, 0x95,
+    0xFF, 0xFF, 0x02, 0xEF, 0xDF, 0x7E, 0xBF, 0x15, 0xDF, 0x80, 0x05, 0xBF, 0x83, 0x05, 0x9F, 0x01,
+    0x2D, 0xFF, 0xA7, 0x1F, 0x9B, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F,
+    0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x01, 0x9F, 0x1F, 0x05, 0xBF, 0x81, 0x05,
+    0x9F, 0x00, 0xD7, 0x9F, 0x9B, 0xFF, 0xFF, 0x02, 0xCF, 0x9F, 0x5E, 0x7F, 0x05, 0xBF, 0x82, 0x05,
+    0x9F, 0x05, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x1D, 0xDF, 0x8E, 0xFF, 0xF7, 0xFF, 0x90, 0xFF,
+    0xFF, 0x03, 0xE7, 0xDF, 0x76, 0xBF, 0x0D, 0xBF, 0x05, 0xBF, 0x84, 0x05, 0x9F, 0x01, 0x2D, 0xFF,
+    0xA7, 0x1F, 0x9D, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF,
+    0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05, 0x9F, 0x00, 0xD7, 0x9F,
+    0x9D, 0xFF, 0xFF, 0x02, 0xDF, 0x9F, 0x76, 0x9F, 0x0D, 0xBF, 0x80, 0x05, 0x9F, 0x00, 0x05, 0xBF,
+    0x82, 0x05, 0x9F, 0x02, 0x15, 0xBF, 0x7E, 0xDF, 0xEF, 0xBF, 0x8C, 0xFF, 0xFF, 0x02, 0xE7, 0xBF,
+    0x6E, 0x9F, 0x0D, 0xBF, 0x82, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x01, 0x2E, 0x1F,
+    0xA7, 0x3F, 0x9F, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF,
+    0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05, 0x9F, 0x00, 0xD7, 0x9F,
+    0x9F, 0xFF, 0xFF, 0x03, 0xEF, 0xDF, 0x86, 0xDF, 0x15, 0xDF, 0x05, 0xBF, 0x84, 0x05, 0x9F, 0x02,
+    0x0D, 0xBF, 0x66, 0x9F, 0xDF, 0xBF, 0x88, 0xFF, 0xFF, 0x03, 0xDF, 0xBF, 0x66, 0x9F, 0x05, 0xBF,
+    0x05, 0x9F, 0x80, 0x05, 0xBF, 0x82, 0x05, 0x9F, 0x01, 0x2E, 0x1F, 0xAF, 0x3F, 0xA1, 0xFF, 0xFF,
+    0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4,
+    0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05, 0x9F, 0x00, 0xD7, 0x9F, 0xA1, 0xFF, 0xFF, 0x02, 0xF7,
+    0xFF, 0x9F, 0x1F, 0x25, 0xFF, 0x80, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x82, 0x05, 0x9F, 0x02, 0x05,
+    0xBF, 0x5E, 0x7F, 0xCF, 0x7F, 0x84, 0xFF, 0xFF, 0x02, 0xCF, 0x7F, 0x5E, 0x7F, 0x05, 0xBF, 0x80,
+    0x05, 0x9F, 0x00, 0x05, 0xBF, 0x82, 0x05, 0x9F, 0x01, 0x36, 0x1F, 0xAF, 0x3F, 0xA3, 0xFF, 0xFF,
+    0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4,
+    0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05, 0x9F, 0x00, 0xD7, 0x9F, 0xA4, 0xFF, 0xFF, 0x01, 0xAF,
+    0x3F, 0x3E, 0x3F, 0x83, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x05, 0x3E, 0x3F, 0x96,
+    0xFF, 0xBF, 0x5F, 0xA7, 0x3F, 0x7E, 0xBF, 0x3E, 0x3F, 0x80, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x83,
+    0x05, 0x9F, 0x01, 0x36, 0x1F, 0xAF, 0x3F, 0xA5, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F,
+    0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82,
+    0x05, 0x9F, 0x00, 0xD7, 0x9F, 0xA6, 0xFF, 0xFF, 0x01, 0xC7, 0x7F, 0x4E, 0x5F, 0x83, 0x05, 0x9F,
+    0x00, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x84, 0x05, 0x9F, 0x03, 0x05, 0xBF, 0x05,
+    0x9F, 0x36, 0x1F, 0xB7, 0x5F, 0xA7, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46,
+    0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05, 0x9F,
+    0x00, 0xD7, 0x9F, 0xA8, 0xFF, 0xFF, 0x05, 0xDF, 0x9F, 0x66, 0x9F, 0x0D, 0xBF, 0x05, 0xBF, 0x05,
+    0x9F, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x81, 0x05, 0xBF, 0x01, 0x05, 0x9F, 0x05, 0xBF, 0x80, 0x05,
+    0x9F, 0x01, 0x3E, 0x3F, 0xB7, 0x5F, 0xA9, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00,
+    0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05,
+    0x9F, 0x00, 0xD7, 0x9F, 0xAA, 0xFF, 0xFF, 0x02, 0xE7, 0xBF, 0x7E, 0xBF, 0x15, 0xDF, 0x82, 0x05,
+    0x9F, 0x00, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x03, 0x05, 0xBF, 0x05, 0x9F, 0x3E, 0x3F, 0xBF, 0x5F,
+    0xAB, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05, 0x9F, 0x00, 0xD7, 0x9F, 0xAC, 0xFF,
+    0xFF, 0x03, 0xF7, 0xDF, 0x9F, 0x1F, 0x46, 0x3F, 0x0D, 0xBF, 0x80, 0x05, 0x9F, 0x03, 0x05, 0xBF,
+    0x15, 0xBF, 0x66, 0x7F, 0xC7, 0x7F, 0xAD, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00,
+    0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05,
+    0x9F, 0x00, 0xD7, 0x9F, 0xB0, 0xFF, 0xFF, 0x02, 0xF7, 0xDF, 0xDF, 0xBF, 0xF7, 0xFF, 0xB0, 0xFF,
+    0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D,
+    0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05, 0x9F, 0x00, 0xD7, 0x9F, 0xE5, 0xFF, 0xFF, 0x00,
+    0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF,
+    0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05, 0x9F, 0x00, 0xCF, 0x9F, 0xE5, 0xFF, 0xFF, 0x00, 0x26, 0x1F,
+    0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00,
+    0x9F, 0x1F, 0x82, 0x05, 0x9F, 0x00, 0xD7, 0x9F, 0xE5, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05,
+    0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F,
+    0x82, 0x05, 0x9F, 0x00, 0xD7, 0x9F, 0xE5, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0x81, 0x05, 0x9F, 0x00,
+    0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05,
+    0x9F, 0x00, 0xD7, 0x9F, 0xE5, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F,
+    0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05, 0x9F, 0x00,
+    0xD7, 0x9F, 0xE5, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF,
+    0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x82, 0x05, 0x9F, 0x00, 0xCF, 0x9F,
+    0xE5, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x81, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x05, 0x9F, 0x1F, 0x05, 0x9F, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xBF,
+    0xCF, 0x9F, 0xE4, 0xFF, 0xFF, 0x00, 0xF7, 0xDF, 0x82, 0x05, 0x9F, 0x00, 0x46, 0x3F, 0xE4, 0xFF,
+    0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0x9F, 0x1F, 0x81, 0x05, 0x9F, 0x01, 0x05, 0xBF,
+    0xCF, 0x9F, 0xE4, 0xFF, 0xFF, 0x00, 0x8E, 0xFF, 0x82, 0x05, 0x9F, 0x00, 0x56, 0x7F, 0xE4, 0xFF,
+    0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0xA7, 0x1F, 0x82, 0x05, 0x9F, 0x00, 0xCF, 0x7F,
+    0xE3, 0xFF, 0xFF, 0x01, 0x8E, 0xFF, 0x05, 0xBF, 0x82, 0x05, 0x9F, 0x00, 0x8E, 0xFF, 0xE4, 0xFF,
+    0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x00, 0xC7, 0x7F, 0x82, 0x05, 0x9F, 0x00, 0x66, 0x9F,
+    0xE1, 0xFF, 0xFF, 0x01, 0xAF, 0x3F, 0x2E, 0x1F, 0x83, 0x05, 0x9F, 0x01, 0x15, 0xDF, 0xEF, 0xDF,
+    0xE4, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE4, 0xFF, 0xFF, 0x01, 0xF7, 0xDF, 0x0D, 0xBF, 0x80, 0x05,
+    0x9F, 0x03, 0x05, 0xBF, 0x05, 0x9F, 0x5E, 0x7F, 0xDF, 0x9F, 0xDD, 0xFF, 0xFF, 0x01, 0xAF, 0x3F,
+    0x2E, 0x1F, 0x80, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x01, 0x0D, 0xBF, 0xB7, 0x5F,
+    0xE5, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE5, 0xFF, 0xFF, 0x01, 0x66, 0x9F, 0x05, 0x9F, 0x80, 0x05,
+    0xBF, 0x00, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x01, 0x66, 0x9F, 0xDF, 0xBF, 0xD9, 0xFF, 0xFF, 0x01,
+    0xB7, 0x3F, 0x36, 0x1F, 0x81, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x03, 0x05, 0x9F, 0x05, 0xBF, 0x25,
+    0xFF, 0xCF, 0x9F, 0xE6, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE5, 0xFF, 0xFF, 0x03, 0xEF, 0xDF, 0x1D,
+    0xFF, 0x05, 0x9F, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x01, 0x56, 0x7F, 0xC7, 0x7F,
+    0xD5, 0xFF, 0xFF, 0x01, 0xAF, 0x3F, 0x36, 0x1F, 0x81, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x81, 0x05,
+    0x9F, 0x02, 0x1D, 0xFF, 0x97, 0x1F, 0xFF, 0xDF, 0xE7, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xE6, 0xFF,
+    0xFF, 0x03, 0xDF, 0xBF, 0x2E, 0x1F, 0x05, 0x9F, 0x05, 0xBF, 0x82, 0x05, 0x9F, 0x03, 0x05, 0xBF,
+    0x05, 0x9F, 0x3E, 0x3F, 0xB7, 0x3F, 0xD1, 0xFF, 0xFF, 0x01, 0xB7, 0x5F, 0x36, 0x1F, 0x80, 0x05,
+    0x9F, 0x80, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x01, 0x1D, 0xFF, 0x96, 0xFF, 0xEA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xE7, 0xFF, 0xFF, 0x03, 0xF7, 0xFF, 0x86, 0xDF, 0x15, 0xDF, 0x05, 0xBF, 0x85, 0x05,
+    0x9F, 0x01, 0x2E, 0x1F, 0x9F, 0x1F, 0xCD, 0xFF, 0xFF, 0x01, 0xB7, 0x5F, 0x36, 0x1F, 0x81, 0x05,
+    0x9F, 0x00, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x02, 0x05, 0xBF, 0x1D, 0xFF, 0x96, 0xFF, 0xEC, 0xFF,
+    0xFF, 0x80, 0xEF, 0x7D, 0xE9, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0x9E, 0xFF, 0x25, 0xFF, 0x80, 0x05,
+    0x9F, 0x02, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x02, 0x1D, 0xDF, 0x86, 0xDF,
+    0xEF, 0xDF, 0xC8, 0xFF, 0xFF, 0x01, 0xBF, 0x5F, 0x36, 0x1F, 0x80, 0x05, 0x9F, 0x02, 0x05, 0xBF,
+    0x05, 0x9F, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x01, 0x1D, 0xDF, 0x96, 0xFF, 0xEE, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xEC, 0xFF, 0xFF, 0x01, 0xB7, 0x3F, 0x3E, 0x3F, 0x86, 0x05, 0x9F, 0x02, 0x0D, 0xBF,
+    0x76, 0xBF, 0xE7, 0xBF, 0xC4, 0xFF, 0xFF, 0x02, 0xB7, 0x5F, 0x3E, 0x1F, 0x05, 0xBF, 0x81, 0x05,
+    0x9F, 0x00, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x02, 0x15, 0xDF, 0x8E, 0xFF, 0xF7, 0xFF, 0xEF, 0xFF,
+    0xFF, 0x80, 0xEF, 0x7D, 0xEE, 0xFF, 0xFF, 0x02, 0xCF, 0x9F, 0x5E, 0x7F, 0x05, 0xBF, 0x85, 0x05,
+    0x9F, 0x02, 0x05, 0xBF, 0x5E, 0x7F, 0xD7, 0x9F, 0xC0, 0xFF, 0xFF, 0x01, 0xBF, 0x5F, 0x3E, 0x3F,
+    0x84, 0x05, 0x9F, 0x03, 0x05, 0xBF, 0x15, 0xDF, 0x8E, 0xFF, 0xF7, 0xFF, 0xF1, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xF0, 0xFF, 0xFF, 0x02, 0xE7, 0xBF, 0x76, 0xBF, 0x0D, 0xBF, 0x86, 0x05, 0x9F, 0x01,
+    0x46, 0x3F, 0xBF, 0x5F, 0xBC, 0xFF, 0xFF, 0x01, 0xBF, 0x5F, 0x3E, 0x3F, 0x81, 0x05, 0x9F, 0x80,
+    0x05, 0xBF, 0x80, 0x05, 0x9F, 0x02, 0x15, 0xDF, 0x8E, 0xFF, 0xF7, 0xDF, 0xF3, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xF2, 0xFF, 0xFF, 0x02, 0xF7, 0xDF, 0x8E, 0xDF, 0x1D, 0xDF, 0x83, 0x05, 0x9F, 0x00,
+    0x05, 0xBF, 0x80, 0x05, 0x9F, 0x01, 0x36, 0x1F, 0xA7, 0x3F, 0xB8, 0xFF, 0xFF, 0x01, 0xBF, 0x7F,
+    0x3E, 0x3F, 0x85, 0x05, 0x9F, 0x02, 0x15, 0xDF, 0x8E, 0xFF, 0xF7, 0xDF, 0xF5, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xF5, 0xFF, 0xFF, 0x01, 0xA7, 0x1F, 0x2E, 0x1F, 0x80, 0x05, 0x9F, 0x00, 0x05, 0xBF,
+    0x83, 0x05, 0x9F, 0x02, 0x25, 0xFF, 0x96, 0xFF, 0xF7, 0xDF, 0xB3, 0xFF, 0xFF, 0x03, 0xC7, 0x7F,
+    0x46, 0x3F, 0x05, 0xBF, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x02, 0x15, 0xBF, 0x8E,
+    0xDF, 0xF7, 0xDF, 0xF7, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xF7, 0xFF, 0xFF, 0x02, 0xBF, 0x5F, 0x4E,
+    0x5F, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x83, 0x05, 0x9F, 0x02, 0x15, 0xDF, 0x7E, 0xBF, 0xE7, 0xDF,
+    0xAF, 0xFF, 0xFF, 0x03, 0xC7, 0x7F, 0x46, 0x3F, 0x05, 0x9F, 0x05, 0xBF, 0x83, 0x05, 0x9F, 0x02,
+    0x15, 0xDF, 0x86, 0xDF, 0xF7, 0xDF, 0xF9, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xF9, 0xFF, 0xFF, 0x03,
+    0xD7, 0x9F, 0x66, 0x7F, 0x05, 0xBF, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x82, 0x05, 0x9F, 0x02, 0x0D,
+    0xBF, 0x66, 0x7F, 0xD7, 0x9F, 0xAB, 0xFF, 0xFF, 0x03, 0xC7, 0x7F, 0x46, 0x3F, 0x05, 0x9F, 0x05,
+    0xBF, 0x83, 0x05, 0x9F, 0x02, 0x15, 0xDF, 0x86, 0xDF, 0xF7, 0xDF, 0xFB, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFB, 0xFF, 0xFF, 0x02, 0xE7, 0xBF, 0x7E, 0xDF, 0x15, 0xDF, 0x85, 0x05, 0x9F, 0x02, 0x05,
+    0xBF, 0x4E, 0x5F, 0xC7, 0x7F, 0xA7, 0xFF, 0xFF, 0x01, 0xC7, 0x7F, 0x46, 0x3F, 0x82, 0x05, 0x9F,
+    0x80, 0x05, 0xBF, 0x03, 0x05, 0x9F, 0x15, 0xDF, 0x86, 0xDF, 0xF7, 0xDF, 0xFD, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFD, 0xFF, 0xFF, 0x03, 0xF7, 0xDF, 0x96, 0xFF, 0x25, 0xFF, 0x05, 0x9F, 0x80, 0x05,
+    0xBF, 0x81, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x01, 0x3E, 0x3F, 0xAF, 0x5F, 0xA3, 0xFF, 0xFF, 0x04,
+    0xCF, 0x7F, 0x4E, 0x5F, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x82, 0x05, 0x9F, 0x02, 0x0D, 0xBF,
+    0x7E, 0xDF, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF,
+    0xAF, 0x3F, 0x3E, 0x1F, 0x86, 0x05, 0x9F, 0x02, 0x25, 0xFF, 0x9F, 0x1F, 0xF7, 0xFF, 0x9E, 0xFF,
+    0xFF, 0x01, 0xCF, 0x7F, 0x4E, 0x5F, 0x81, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x02,
+    0x0D, 0xBF, 0x7E, 0xDF, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF,
+    0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x02, 0xC7, 0x7F, 0x56, 0x5F, 0x05, 0xBF, 0x85, 0x05, 0x9F, 0x02,
+    0x15, 0xDF, 0x86, 0xDF, 0xEF, 0xDF, 0x9A, 0xFF, 0xFF, 0x02, 0xCF, 0x7F, 0x4E, 0x5F, 0x05, 0xBF,
+    0x84, 0x05, 0x9F, 0x02, 0x0D, 0xBF, 0x7E, 0xBF, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF,
+    0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x02, 0xDF, 0xBF, 0x6E, 0x9F, 0x0D, 0xBF,
+    0x81, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x03, 0x05, 0xBF, 0x0D, 0xBF, 0x6E, 0x9F,
+    0xDF, 0xBF, 0x96, 0xFF, 0xFF, 0x05, 0xCF, 0x7F, 0x4E, 0x5F, 0x05, 0x9F, 0x05, 0xBF, 0x05, 0x9F,
+    0x05, 0xBF, 0x81, 0x05, 0x9F, 0x02, 0x0D, 0xBF, 0x7E, 0xBF, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0x84,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x85, 0xFF, 0xFF, 0x03, 0xF7, 0xDF, 0x86, 0xDF,
+    0x1D, 0xDF, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x80, 0x05, 0xBF,
+    0x01, 0x5E, 0x7F, 0xCF, 0x7F, 0x92, 0xFF, 0xFF, 0x01, 0xCF, 0x9F, 0x4E, 0x5F, 0x85, 0x05, 0x9F,
+    0x02, 0x0D, 0xBF, 0x76, 0xBF, 0xEF, 0xDF, 0xFF, 0xFF, 0xFF, 0x86, 0xFF, 0xFF, 0x80, 0xEF, 0x7D,
+    0xFF, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x01, 0x9F, 0x1F, 0x2E, 0x1F, 0x80, 0x05, 0x9F, 0x80, 0x05,
+    0xBF, 0x82, 0x05, 0x9F, 0x01, 0x46, 0x5F, 0xBF, 0x5F, 0x8E, 0xFF, 0xFF, 0x01, 0xCF, 0x9F, 0x4E,
+    0x5F, 0x83, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x02, 0x0D, 0xBF, 0x76, 0xBF, 0xE7, 0xDF, 0xFF, 0xFF,
+    0xFF, 0x88, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x8A, 0xFF, 0xFF, 0x02, 0xB7, 0x5F,
+    0x46, 0x3F, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x04, 0x05, 0xBF, 0x05, 0x9F, 0x05,
+    0xBF, 0x2E, 0x1F, 0xA7, 0x1F, 0x8A, 0xFF, 0xFF, 0x03, 0xD7, 0x9F, 0x56, 0x7F, 0x05, 0x9F, 0x05,
+    0xBF, 0x80, 0x05, 0x9F, 0x05, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x0D, 0xBF, 0x76, 0x9F, 0xE7,
+    0xBF, 0xFF, 0xFF, 0xFF, 0x8A, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF,
+    0x02, 0xCF, 0x9F, 0x5E, 0x7F, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x81, 0x05, 0x9F,
+    0x02, 0x1D, 0xDF, 0x7E, 0xBF, 0xCF, 0x7F, 0x85, 0xFF, 0xFF, 0x01, 0xB7, 0x3F, 0x46, 0x5F, 0x81,
+    0x05, 0x9F, 0x00, 0x05, 0xBF, 0x81, 0x05, 0x9F, 0x02, 0x0D, 0xBF, 0x6E, 0x9F, 0xE7, 0xBF, 0xFF,
+    0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x8E, 0xFF, 0xFF, 0x02, 0xE7,
+    0xBF, 0x76, 0xBF, 0x0D, 0xBF, 0x83, 0x05, 0x9F, 0x0A, 0x05, 0xBF, 0x05, 0x9F, 0x05, 0xBF, 0x25,
+    0xDF, 0x56, 0x7F, 0x76, 0xBF, 0x8E, 0xFF, 0x76, 0xBF, 0x4E, 0x5F, 0x25, 0xDF, 0x05, 0xBF, 0x81,
+    0x05, 0x9F, 0x00, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x02, 0x05, 0xBF, 0x6E, 0x9F, 0xE7, 0xBF, 0xFF,
+    0xFF, 0xFF, 0x8E, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0x02, 0xF7,
+    0xDF, 0x8E, 0xFF, 0x1D, 0xFF, 0x80, 0x05, 0x9F, 0x00, 0x05, 0xBF, 0x82, 0x05, 0x9F, 0x00, 0x05,
+    0xBF, 0x88, 0x05, 0x9F, 0x02, 0x05, 0xBF, 0x6E, 0x9F, 0xE7, 0xBF, 0xFF, 0xFF, 0xFF, 0x90, 0xFF,
+    0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x93, 0xFF, 0xFF, 0x01, 0xA7, 0x3F, 0x36, 0x1F, 0x8C,
+    0x05, 0x9F, 0x02, 0x05, 0xBF, 0x66, 0x9F, 0xE7, 0xBF, 0xFF, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x02, 0xBF, 0x7F, 0x4E, 0x5F, 0x05, 0xBF, 0x81,
+    0x05, 0x9F, 0x01, 0x05, 0xBF, 0x05, 0x9F, 0x80, 0x05, 0xBF, 0x80, 0x05, 0x9F, 0x02, 0x1D, 0xFF,
+    0x76, 0xBF, 0xDF, 0xBF, 0xFF, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0x97, 0xFF, 0xFF, 0x09, 0xF7, 0xDF, 0xB7, 0x5F, 0x76, 0xBF, 0x4E, 0x3F, 0x2D, 0xFF, 0x15, 0xDF,
+    0x2E, 0x1F, 0x4E, 0x5F, 0x6E, 0xBF, 0xBF, 0x7F, 0xFF, 0xFF, 0xFF, 0x97, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xD5, 0xFF, 0xFF, 0x01, 0xE7, 0x1C, 0x94, 0xB2, 0x8B, 0xFF, 0xFF, 0x01, 0xBD, 0xD7, 0xBD,
+    0xF7, 0x85, 0xFF, 0xFF, 0x00, 0xE7, 0x3C, 0x81, 0x73, 0x8E, 0x82, 0x73, 0xAE, 0x80, 0x7B, 0xCF,
+    0x00, 0xCE, 0x79, 0x8A, 0xFF, 0xFF, 0x06, 0xC6, 0x18, 0x94, 0x92, 0x7B, 0xCF, 0x8C, 0x71, 0xAD,
+    0x55, 0xCE, 0x59, 0xFF, 0xDF, 0x89, 0xFF, 0xFF, 0x00, 0xA5, 0x14, 0x81, 0x73, 0x8E, 0x85, 0x73,
+    0xAE, 0x80, 0x7B, 0xCF, 0x00, 0xBD, 0xD7, 0x8D, 0xFF, 0xFF, 0x01, 0x84, 0x30, 0xE7, 0x1C, 0x90,
+    0xFF, 0xFF, 0x03, 0xEF, 0x5D, 0xAD, 0x55, 0x73, 0xAE, 0x73, 0x8E, 0x81, 0x73, 0xAE, 0x00, 0xB5,
+    0x96, 0x85, 0xFF, 0xFF, 0x01, 0xDE, 0xFB, 0x9C, 0xD3, 0x88, 0xFF, 0xFF, 0x02, 0xF7, 0xBE, 0x94,
+    0x92, 0xF7, 0x9E, 0xD5, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00,
+    0x00, 0x9C, 0xF3, 0x89, 0xFF, 0xFF, 0x02, 0xE7, 0x3C, 0x08, 0x61, 0x39, 0xE7, 0x85, 0xFF, 0xFF,
+    0x02, 0x8C, 0x71, 0x00, 0x00, 0x10, 0xA2, 0x85, 0x18, 0xC3, 0x00, 0xA5, 0x14, 0x88, 0xFF, 0xFF,
+    0x01, 0xDE, 0xDB, 0x31, 0x86, 0x80, 0x00, 0x00, 0x00, 0x10, 0x82, 0x81, 0x00, 0x00, 0x02, 0x10,
+    0x82, 0x63, 0x0C, 0xBD, 0xF7, 0x87, 0xFF, 0xFF, 0x00, 0x52, 0xAA, 0x83, 0x18, 0xC3, 0x01, 0x00,
+    0x20, 0x08, 0x41, 0x81, 0x18, 0xC3, 0x02, 0x10, 0xA2, 0x18, 0xC3, 0x7B, 0xCF, 0x8C, 0xFF, 0xFF,
+    0x02, 0xC6, 0x18, 0x00, 0x00, 0x73, 0xAE, 0x8E, 0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x6B, 0x4D, 0x00,
+    0x20, 0x00, 0x00, 0x10, 0xA2, 0x82, 0x18, 0xC3, 0x00, 0x6B, 0x6D, 0x85, 0xFF, 0xFF, 0x02, 0x94,
+    0x92, 0x00, 0x00, 0xF7, 0xBE, 0x86, 0xFF, 0xFF, 0x03, 0xFF, 0xDF, 0x4A, 0x69, 0x00, 0x20, 0xD6,
+    0xBA, 0xD5, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x03, 0x9C, 0xF3, 0x00, 0x00, 0x10,
+    0xA2, 0xEF, 0x7D, 0x88, 0xFF, 0xFF, 0x02, 0x5A, 0xEB, 0x00, 0x00, 0x42, 0x08, 0x85, 0xFF, 0xFF,
+    0x02, 0x8C, 0x71, 0x00, 0x00, 0xF7, 0xBE, 0x8F, 0xFF, 0xFF, 0x04, 0xDE, 0xFB, 0x10, 0x82, 0x18,
+    0xE3, 0xA5, 0x34, 0xF7, 0xBE, 0x80, 0xFF, 0xFF, 0x02, 0xE7, 0x3C, 0xAD, 0x55, 0x6B, 0x4D, 0x80,
+    0x18, 0xE3, 0x8D, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x92, 0xFF, 0xFF, 0x02, 0x6B, 0x6D,
+    0x00, 0x00, 0x21, 0x04, 0x8D, 0xFF, 0xFF, 0x04, 0xF7, 0xBE, 0x39, 0xC7, 0x08, 0x61, 0x94, 0x92,
+    0xF7, 0xBE, 0x8B, 0xFF, 0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0xF7, 0xBE, 0x86, 0xFF, 0xFF, 0x02,
+    0x63, 0x0C, 0x00, 0x00, 0xA5, 0x14, 0xD6, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x00,
+    0x9C, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x63, 0x2C, 0x87, 0xFF, 0xFF, 0x00, 0xC6, 0x18, 0x80, 0x00,
+    0x00, 0x00, 0x42, 0x08, 0x85, 0xFF, 0xFF, 0x02, 0x8C, 0x71, 0x00, 0x00, 0xF7, 0xBE, 0x8F, 0xFF,
+    0xFF, 0x02, 0x39, 0xE7, 0x18, 0xC3, 0xE7, 0x3C, 0x86, 0xFF, 0xFF, 0x00, 0xEF, 0x7D, 0x8D, 0xFF,
+    0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x92, 0xFF, 0xFF, 0x03, 0x18, 0xC3, 0x10, 0x82, 0x00, 0x00,
+    0xCE, 0x79, 0x8C, 0xFF, 0xFF, 0x02, 0x73, 0xAE, 0x00, 0x20, 0xC6, 0x18, 0x8D, 0xFF, 0xFF, 0x02,
+    0x94, 0x92, 0x00, 0x00, 0xF7, 0xBE, 0x85, 0xFF, 0xFF, 0x02, 0x73, 0xAE, 0x00, 0x00, 0x8C, 0x71,
+    0xD7, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x04, 0x9C, 0xF3, 0x00, 0x00, 0x63, 0x0C,
+    0x00, 0x00, 0xCE, 0x59, 0x85, 0xFF, 0xFF, 0x04, 0xFF, 0xDF, 0x29, 0x65, 0x21, 0x04, 0x39, 0xE7,
+    0x42, 0x08, 0x85, 0xFF, 0xFF, 0x02, 0x8C, 0x71, 0x00, 0x00, 0xF7, 0xBE, 0x8E, 0xFF, 0xFF, 0x02,
+    0xD6, 0x9A, 0x00, 0x00, 0x94, 0xB2, 0x97, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x91, 0xFF,
+    0xFF, 0x04, 0xC6, 0x18, 0x00, 0x00, 0x9C, 0xD3, 0x08, 0x41, 0x73, 0xAE, 0x8B, 0xFF, 0xFF, 0x02,
+    0xEF, 0x5D, 0x08, 0x41, 0x73, 0x8E, 0x8E, 0xFF, 0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0xF7, 0xBE,
+    0x84, 0xFF, 0xFF, 0x02, 0x8C, 0x51, 0x00, 0x00, 0x7B, 0xCF, 0xD8, 0xFF, 0xFF, 0x80, 0xEF, 0x7D,
+    0xD5, 0xFF, 0xFF, 0x04, 0x9C, 0xF3, 0x00, 0x00, 0xDE, 0xFB, 0x18, 0xE3, 0x31, 0xA6, 0x85, 0xFF,
+    0xFF, 0x04, 0x8C, 0x71, 0x00, 0x00, 0xB5, 0x96, 0x42, 0x28, 0x42, 0x08, 0x85, 0xFF, 0xFF, 0x02,
+    0x8C, 0x71, 0x00, 0x00, 0xF7, 0xBE, 0x8E, 0xFF, 0xFF, 0x02, 0xA5, 0x14, 0x00, 0x00, 0xD6, 0xBA,
+    0x97, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x91, 0xFF, 0xFF, 0x04, 0x6B, 0x6D, 0x08, 0x41,
+    0xF7, 0x9E, 0x52, 0x8A, 0x21, 0x04, 0x8B, 0xFF, 0xFF, 0x02, 0xAD, 0x55, 0x00, 0x00, 0xCE, 0x79,
+    0x8E, 0xFF, 0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0xF7, 0xBE, 0x83, 0xFF, 0xFF, 0x02, 0xA5, 0x14,
+    0x00, 0x00, 0x63, 0x0C, 0xD9, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x05, 0x9C, 0xF3,
+    0x00, 0x00, 0xE7, 0x3C, 0xAD, 0x75, 0x00, 0x00, 0x94, 0xB2, 0x83, 0xFF, 0xFF, 0x05, 0xE7, 0x3C,
+    0x08, 0x61, 0x4A, 0x69, 0xFF, 0xFF, 0x42, 0x28, 0x42, 0x08, 0x85, 0xFF, 0xFF, 0x02, 0x8C, 0x71,
+    0x00, 0x00, 0xF7, 0xBE, 0x8E, 0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00, 0x00, 0xDE, 0xFB, 0x97, 0xFF,
+    0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x91, 0xFF, 0xFF, 0x05, 0x18, 0xC3, 0x52, 0x8A, 0xFF, 0xFF,
+    0xA5, 0x34, 0x00, 0x00, 0xCE, 0x79, 0x8A, 0xFF, 0xFF, 0x01, 0x84, 0x10, 0x00, 0x20, 0x8F, 0xFF,
+    0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0xF7, 0xBE, 0x82, 0xFF, 0xFF, 0x03, 0xB5, 0x96, 0x00, 0x00,
+    0x4A, 0x69, 0xFF, 0xDF, 0xD9, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x06, 0x9C, 0xF3,
+    0x00, 0x00, 0xE7, 0x3C, 0xFF, 0xFF, 0x42, 0x28, 0x10, 0x82, 0xEF, 0x5D, 0x82, 0xFF, 0xFF, 0x05,
+    0x5A, 0xCB, 0x08, 0x41, 0xDE, 0xFB, 0xFF, 0xFF, 0x42, 0x28, 0x42, 0x08, 0x85, 0xFF, 0xFF, 0x02,
+    0x8C, 0x71, 0x00, 0x00, 0xF7, 0xBE, 0x8E, 0xFF, 0xFF, 0x02, 0xC6, 0x38, 0x00, 0x00, 0xA5, 0x34,
+    0x97, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x90, 0xFF, 0xFF, 0x06, 0xC6, 0x18, 0x00, 0x00,
+    0xA5, 0x34, 0xFF, 0xFF, 0xF7, 0x9E, 0x00, 0x20, 0x7B, 0xCF, 0x8A, 0xFF, 0xFF, 0x01, 0x84, 0x10,
+    0x00, 0x20, 0x8F, 0xFF, 0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0xF7, 0xBE, 0x81, 0xFF, 0xFF, 0x03,
+    0xC6, 0x18, 0x08, 0x41, 0x39, 0xE7, 0xF7, 0xBE, 0xDA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF,
+    0xFF, 0x06, 0x9C, 0xF3, 0x00, 0x00, 0xE7, 0x3C, 0xFF, 0xFF, 0xDE, 0xDB, 0x00, 0x20, 0x63, 0x2C,
+    0x81, 0xFF, 0xFF, 0x02, 0xC6, 0x18, 0x00, 0x00, 0x84, 0x10, 0x80, 0xFF, 0xFF, 0x01, 0x42, 0x28,
+    0x42, 0x08, 0x85, 0xFF, 0xFF, 0x02, 0x8C, 0x71, 0x00, 0x00, 0xFF, 0xDF, 0x8F, 0xFF, 0xFF, 0x80,
+    0x21, 0x24, 0x00, 0xF7, 0xBE, 0x96, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x90, 0xFF, 0xFF,
+    0x02, 0x6B, 0x6D, 0x08, 0x41, 0xF7, 0x9E, 0x80, 0xFF, 0xFF, 0x01, 0x4A, 0x69, 0x21, 0x24, 0x8A,
+    0xFF, 0xFF, 0x01, 0x84, 0x10, 0x00, 0x20, 0x8F, 0xFF, 0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0xF7,
+    0xBE, 0x80, 0xFF, 0xFF, 0x03, 0xD6, 0x9A, 0x10, 0x82, 0x29, 0x65, 0xF7, 0x9E, 0xDB, 0xFF, 0xFF,
+    0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00, 0x00, 0xE7, 0x3C, 0x80, 0xFF, 0xFF,
+    0x07, 0x7B, 0xEF, 0x00, 0x00, 0xC6, 0x38, 0xFF, 0xFF, 0xFF, 0xDF, 0x29, 0x45, 0x21, 0x24, 0xF7,
+    0xBE, 0x80, 0xFF, 0xFF, 0x01, 0x42, 0x28, 0x42, 0x08, 0x85, 0xFF, 0xFF, 0x02, 0x8C, 0x71, 0x00,
+    0x00, 0xF7, 0xBE, 0x8F, 0xFF, 0xFF, 0x03, 0xC6, 0x18, 0x00, 0x00, 0x39, 0xC7, 0xDE, 0xDB, 0x95,
+    0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x90, 0xFF, 0xFF, 0x01, 0x18, 0xC3, 0x52, 0x8A, 0x81,
+    0xFF, 0xFF, 0x02, 0xA5, 0x14, 0x00, 0x00, 0xCE, 0x79, 0x89, 0xFF, 0xFF, 0x01, 0x84, 0x10, 0x00,
+    0x20, 0x8F, 0xFF, 0xFF, 0x07, 0x94, 0x92, 0x00, 0x00, 0xF7, 0xBE, 0xFF, 0xFF, 0xDE, 0xFB, 0x18,
+    0xC3, 0x00, 0x00, 0xDE, 0xFB, 0xDC, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x02, 0x9C,
+    0xF3, 0x00, 0x00, 0xEF, 0x5D, 0x80, 0xFF, 0xFF, 0x06, 0xF7, 0xBE, 0x21, 0x04, 0x31, 0x86, 0xFF,
+    0xFF, 0x8C, 0x71, 0x00, 0x00, 0xB5, 0xB6, 0x81, 0xFF, 0xFF, 0x01, 0x42, 0x28, 0x42, 0x08, 0x85,
+    0xFF, 0xFF, 0x02, 0x8C, 0x71, 0x00, 0x00, 0x29, 0x65, 0x80, 0x31, 0x86, 0x03, 0x29, 0x65, 0x31,
+    0x86, 0x52, 0xAA, 0xAD, 0x55, 0x8A, 0xFF, 0xFF, 0x04, 0xBD, 0xD7, 0x10, 0x82, 0x00, 0x20, 0x63,
+    0x0C, 0xDE, 0xDB, 0x93, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x8F, 0xFF, 0xFF, 0x02, 0xC6,
+    0x18, 0x00, 0x00, 0xA5, 0x34, 0x81, 0xFF, 0xFF, 0x02, 0xEF, 0x7D, 0x00, 0x20, 0x7B, 0xCF, 0x89,
+    0xFF, 0xFF, 0x01, 0x84, 0x10, 0x00, 0x20, 0x8F, 0xFF, 0xFF, 0x07, 0x94, 0x92, 0x00, 0x00, 0xF7,
+    0xBE, 0xEF, 0x5D, 0x21, 0x24, 0x10, 0x82, 0x00, 0x00, 0x8C, 0x71, 0xDC, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xD5, 0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00, 0x00, 0xE7, 0x3C, 0x81, 0xFF, 0xFF, 0x04, 0xAD,
+    0x75, 0x00, 0x00, 0x7B, 0xCF, 0x08, 0x61, 0x52, 0x8A, 0x82, 0xFF, 0xFF, 0x01, 0x42, 0x28, 0x42,
+    0x08, 0x85, 0xFF, 0xFF, 0x0A, 0xCE, 0x59, 0x52, 0xAA, 0x52, 0x8A, 0x52, 0xAA, 0x52, 0x8A, 0x52,
+    0xAA, 0x4A, 0x49, 0x18, 0xC3, 0x00, 0x00, 0x4A, 0x49, 0xF7, 0xBE, 0x89, 0xFF, 0xFF, 0x05, 0xEF,
+    0x7D, 0x7B, 0xEF, 0x08, 0x61, 0x00, 0x20, 0x63, 0x0C, 0xDE, 0xDB, 0x91, 0xFF, 0xFF, 0x01, 0x31,
+    0x86, 0x52, 0xAA, 0x8F, 0xFF, 0xFF, 0x02, 0x6B, 0x6D, 0x08, 0x41, 0xF7, 0x9E, 0x82, 0xFF, 0xFF,
+    0x01, 0x4A, 0x69, 0x21, 0x24, 0x89, 0xFF, 0xFF, 0x01, 0x84, 0x10, 0x00, 0x20, 0x8F, 0xFF, 0xFF,
+    0x08, 0x94, 0x92, 0x00, 0x00, 0xEF, 0x5D, 0x31, 0x86, 0x08, 0x61, 0xCE, 0x59, 0x52, 0xAA, 0x10,
+    0x82, 0xEF, 0x7D, 0xDB, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00,
+    0x00, 0xE7, 0x3C, 0x82, 0xFF, 0xFF, 0x03, 0x4A, 0x49, 0x00, 0x00, 0x08, 0x41, 0xE7, 0x1C, 0x82,
+    0xFF, 0xFF, 0x01, 0x42, 0x28, 0x42, 0x08, 0x8D, 0xFF, 0xFF, 0x02, 0x94, 0xB2, 0x00, 0x20, 0x52,
+    0xAA, 0x8B, 0xFF, 0xFF, 0x05, 0xEF, 0x7D, 0x7B, 0xEF, 0x08, 0x61, 0x00, 0x20, 0x63, 0x0C, 0xDE,
+    0xDB, 0x8F, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x8F, 0xFF, 0xFF, 0x01, 0x18, 0xC3, 0x52,
+    0x8A, 0x83, 0xFF, 0xFF, 0x02, 0xA5, 0x14, 0x00, 0x00, 0xCE, 0x79, 0x88, 0xFF, 0xFF, 0x01, 0x84,
+    0x10, 0x00, 0x20, 0x8F, 0xFF, 0xFF, 0x08, 0x94, 0x92, 0x00, 0x00, 0x39, 0xE7, 0x00, 0x20, 0xBD,
+    0xF7, 0xFF, 0xFF, 0xDE, 0xDB, 0x00, 0x20, 0x6B, 0x6D, 0xDB, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5,
+    0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00, 0x00, 0xE7, 0x3C, 0x82, 0xFF, 0xFF, 0x02, 0xDE, 0xDB, 0x08,
+    0x61, 0x8C, 0x51, 0x83, 0xFF, 0xFF, 0x01, 0x42, 0x28, 0x42, 0x08, 0x8E, 0xFF, 0xFF, 0x02, 0x94,
+    0xB2, 0x00, 0x00, 0xBD, 0xF7, 0x8C, 0xFF, 0xFF, 0x05, 0xEF, 0x7D, 0x73, 0xAE, 0x08, 0x41, 0x00,
+    0x20, 0x6B, 0x4D, 0xF7, 0x9E, 0x8D, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x8E, 0xFF, 0xFF,
+    0x02, 0xC6, 0x18, 0x00, 0x00, 0xA5, 0x34, 0x83, 0xFF, 0xFF, 0x02, 0xEF, 0x7D, 0x00, 0x20, 0x7B,
+    0xCF, 0x88, 0xFF, 0xFF, 0x01, 0x84, 0x10, 0x00, 0x20, 0x8F, 0xFF, 0xFF, 0x00, 0x94, 0x92, 0x80,
+    0x00, 0x00, 0x00, 0xAD, 0x55, 0x81, 0xFF, 0xFF, 0x02, 0x6B, 0x6D, 0x00, 0x20, 0xDE, 0xDB, 0xDA,
+    0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00, 0x00, 0xE7, 0x3C, 0x83,
+    0xFF, 0xFF, 0x00, 0xF7, 0xBE, 0x84, 0xFF, 0xFF, 0x01, 0x42, 0x28, 0x42, 0x08, 0x8F, 0xFF, 0xFF,
+    0x01, 0x10, 0x82, 0x7B, 0xCF, 0x8E, 0xFF, 0xFF, 0x04, 0xDE, 0xFB, 0x5A, 0xEB, 0x00, 0x00, 0x21,
+    0x24, 0xEF, 0x7D, 0x8C, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x8E, 0xFF, 0xFF, 0x02, 0x6B,
+    0x6D, 0x08, 0x41, 0xF7, 0x9E, 0x84, 0xFF, 0xFF, 0x01, 0x4A, 0x49, 0x21, 0x24, 0x88, 0xFF, 0xFF,
+    0x01, 0x84, 0x10, 0x00, 0x20, 0x8F, 0xFF, 0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0x94, 0xB2, 0x82,
+    0xFF, 0xFF, 0x02, 0xEF, 0x5D, 0x10, 0x82, 0x52, 0x8A, 0xDA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5,
+    0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00, 0x00, 0xE7, 0x3C, 0x8A, 0xFF, 0xFF, 0x01, 0x42, 0x28, 0x42,
+    0x08, 0x8F, 0xFF, 0xFF, 0x01, 0x42, 0x28, 0x52, 0x8A, 0x90, 0xFF, 0xFF, 0x02, 0xA5, 0x34, 0x00,
+    0x00, 0x5A, 0xEB, 0x8C, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x8E, 0xFF, 0xFF, 0x01, 0x18,
+    0xE3, 0x4A, 0x69, 0x85, 0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00, 0x00, 0xCE, 0x79, 0x87, 0xFF, 0xFF,
+    0x01, 0x84, 0x10, 0x00, 0x20, 0x8F, 0xFF, 0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0xF7, 0xBE, 0x83,
+    0xFF, 0xFF, 0x02, 0x8C, 0x51, 0x00, 0x00, 0xC6, 0x18, 0xD9, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5,
+    0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00, 0x00, 0xE7, 0x3C, 0x8A, 0xFF, 0xFF, 0x01, 0x42, 0x28, 0x42,
+    0x08, 0x8F, 0xFF, 0xFF, 0x01, 0x4A, 0x49, 0x31, 0xA6, 0x91, 0xFF, 0xFF, 0x02, 0x63, 0x0C, 0x08,
+    0x41, 0xEF, 0x7D, 0x8B, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x8D, 0xFF, 0xFF, 0x03, 0xC6,
+    0x38, 0x00, 0x00, 0x29, 0x45, 0x4A, 0x69, 0x80, 0x52, 0x8A, 0x00, 0x4A, 0x69, 0x81, 0x52, 0x8A,
+    0x02, 0x42, 0x08, 0x00, 0x00, 0x7B, 0xCF, 0x87, 0xFF, 0xFF, 0x01, 0x84, 0x10, 0x00, 0x20, 0x8F,
+    0xFF, 0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0xF7, 0xBE, 0x83, 0xFF, 0xFF, 0x02, 0xF7, 0xBE, 0x21,
+    0x04, 0x39, 0xC7, 0xD9, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00,
+    0x00, 0xE7, 0x3C, 0x8A, 0xFF, 0xFF, 0x01, 0x42, 0x28, 0x42, 0x08, 0x8F, 0xFF, 0xFF, 0x01, 0x52,
+    0x8A, 0x39, 0xE7, 0x91, 0xFF, 0xFF, 0x02, 0xAD, 0x55, 0x00, 0x00, 0xCE, 0x59, 0x8B, 0xFF, 0xFF,
+    0x01, 0x31, 0x86, 0x52, 0xAA, 0x8D, 0xFF, 0xFF, 0x01, 0x6B, 0x6D, 0x00, 0x20, 0x85, 0x39, 0xC7,
+    0x03, 0x31, 0xA6, 0x39, 0xC7, 0x18, 0xC3, 0x21, 0x24, 0x87, 0xFF, 0xFF, 0x01, 0x8C, 0x51, 0x00,
+    0x20, 0x8F, 0xFF, 0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0xF7, 0xBE, 0x84, 0xFF, 0xFF, 0x02, 0xA5,
+    0x34, 0x00, 0x00, 0xA5, 0x34, 0xD8, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x02, 0x9C,
+    0xF3, 0x00, 0x00, 0xE7, 0x3C, 0x8A, 0xFF, 0xFF, 0x01, 0x42, 0x28, 0x42, 0x08, 0x8F, 0xFF, 0xFF,
+    0x01, 0x42, 0x28, 0x39, 0xE7, 0x91, 0xFF, 0xFF, 0x02, 0xC6, 0x38, 0x00, 0x00, 0xC6, 0x18, 0x8B,
+    0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x8D, 0xFF, 0xFF, 0x01, 0x18, 0xC3, 0x52, 0x8A, 0x87,
+    0xFF, 0xFF, 0x02, 0xA5, 0x34, 0x00, 0x00, 0xD6, 0x9A, 0x86, 0xFF, 0xFF, 0x02, 0xB5, 0x96, 0x00,
+    0x00, 0xF7, 0x9E, 0x8E, 0xFF, 0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0xF7, 0xBE, 0x85, 0xFF, 0xFF,
+    0x02, 0x31, 0xA6, 0x21, 0x04, 0xFF, 0xDF, 0xD7, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF,
+    0x02, 0x9C, 0xF3, 0x00, 0x00, 0xE7, 0x3C, 0x8A, 0xFF, 0xFF, 0x01, 0x42, 0x28, 0x42, 0x08, 0x8F,
+    0xFF, 0xFF, 0x01, 0x18, 0xE3, 0x63, 0x2C, 0x91, 0xFF, 0xFF, 0x02, 0x94, 0xB2, 0x00, 0x00, 0xE7,
+    0x3C, 0x8B, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x8C, 0xFF, 0xFF, 0x02, 0xC6, 0x18, 0x00,
+    0x00, 0xAD, 0x55, 0x87, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x08, 0x41, 0x7B, 0xEF, 0x86, 0xFF, 0xFF,
+    0x02, 0xDE, 0xDB, 0x00, 0x00, 0xAD, 0x75, 0x8E, 0xFF, 0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0xF7,
+    0xBE, 0x85, 0xFF, 0xFF, 0x02, 0xC6, 0x18, 0x00, 0x00, 0x8C, 0x51, 0xD7, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xD5, 0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00, 0x00, 0xE7, 0x3C, 0x8A, 0xFF, 0xFF, 0x01, 0x42,
+    0x28, 0x42, 0x08, 0x8E, 0xFF, 0xFF, 0x02, 0x9C, 0xD3, 0x00, 0x00, 0xB5, 0xB6, 0x85, 0xFF, 0xFF,
+    0x03, 0xB5, 0xB6, 0x18, 0xE3, 0x94, 0xB2, 0xF7, 0xBE, 0x85, 0xFF, 0xFF, 0x02, 0xF7, 0xBE, 0x21,
+    0x24, 0x39, 0xE7, 0x8C, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52, 0xAA, 0x8C, 0xFF, 0xFF, 0x02, 0x6B,
+    0x6D, 0x08, 0x61, 0xF7, 0xBE, 0x88, 0xFF, 0xFF, 0x01, 0x52, 0x8A, 0x21, 0x24, 0x87, 0xFF, 0xFF,
+    0x02, 0x39, 0xE7, 0x21, 0x24, 0xEF, 0x7D, 0x8D, 0xFF, 0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0xF7,
+    0xBE, 0x86, 0xFF, 0xFF, 0x02, 0x4A, 0x69, 0x10, 0x82, 0xEF, 0x7D, 0xD6, 0xFF, 0xFF, 0x80, 0xEF,
+    0x7D, 0xD5, 0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00, 0x00, 0xE7, 0x3C, 0x8A, 0xFF, 0xFF, 0x01, 0x42,
+    0x28, 0x39, 0xE7, 0x8D, 0xFF, 0xFF, 0x02, 0xA5, 0x14, 0x00, 0x20, 0x4A, 0x49, 0x86, 0xFF, 0xFF,
+    0x05, 0xEF, 0x5D, 0x4A, 0x69, 0x00, 0x00, 0x10, 0x82, 0x6B, 0x6D, 0xD6, 0x9A, 0x82, 0xFF, 0xFF,
+    0x03, 0xEF, 0x5D, 0x42, 0x28, 0x00, 0x20, 0xC6, 0x38, 0x8C, 0xFF, 0xFF, 0x01, 0x31, 0x86, 0x52,
+    0xAA, 0x8C, 0xFF, 0xFF, 0x01, 0x18, 0xC3, 0x5A, 0xCB, 0x89, 0xFF, 0xFF, 0x02, 0xA5, 0x34, 0x00,
+    0x00, 0xD6, 0x9A, 0x86, 0xFF, 0xFF, 0x03, 0xCE, 0x79, 0x08, 0x61, 0x29, 0x65, 0xCE, 0x59, 0x8C,
+    0xFF, 0xFF, 0x02, 0x94, 0x92, 0x00, 0x00, 0xF7, 0xBE, 0x86, 0xFF, 0xFF, 0x02, 0xD6, 0xBA, 0x00,
+    0x20, 0x6B, 0x6D, 0xD6, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x02, 0x9C, 0xF3, 0x00,
+    0x00, 0xE7, 0x3C, 0x8A, 0xFF, 0xFF, 0x01, 0x42, 0x28, 0x42, 0x08, 0x85, 0xFF, 0xFF, 0x00, 0xE7,
+    0x1C, 0x81, 0x6B, 0x4D, 0x06, 0x63, 0x2C, 0x6B, 0x4D, 0x63, 0x2C, 0x29, 0x65, 0x00, 0x00, 0x39,
+    0xE7, 0xF7, 0x9E, 0x88, 0xFF, 0xFF, 0x01, 0xBD, 0xD7, 0x42, 0x28, 0x80, 0x00, 0x00, 0x06, 0x18,
+    0xC3, 0x39, 0xE7, 0x63, 0x0C, 0x52, 0xAA, 0x08, 0x61, 0x00, 0x20, 0xAD, 0x75, 0x8D, 0xFF, 0xFF,
+    0x01, 0x31, 0x86, 0x52, 0xAA, 0x8B, 0xFF, 0xFF, 0x02, 0xC6, 0x18, 0x00, 0x00, 0xB5, 0x96, 0x89,
+    0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0x08, 0x41, 0x7B, 0xEF, 0x87, 0xFF, 0xFF, 0x04, 0xC6, 0x18, 0x10,
+    0xA2, 0x00, 0x00, 0x29, 0x65, 0x5A, 0xEB, 0x82, 0x6B, 0x4D, 0x00, 0xB5, 0x96, 0x85, 0xFF, 0xFF,
+    0x02, 0x94, 0x92, 0x00, 0x00, 0xF7, 0xBE, 0x87, 0xFF, 0xFF, 0x02, 0x6B, 0x4D, 0x00, 0x20, 0xDE,
+    0xDB, 0xD5, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xD5, 0xFF, 0xFF, 0x02, 0xC6, 0x18, 0x29, 0x65, 0xF7,
+    0xBE, 0x8A, 0xFF, 0xFF, 0x01, 0x73, 0xAE, 0x6B, 0x6D, 0x85, 0xFF, 0xFF, 0x01, 0xB5, 0xB6, 0x21,
+    0x04, 0x80, 0x18, 0xE3, 0x80, 0x18, 0xC3, 0x02, 0x31, 0x86, 0x5A, 0xEB, 0xA5, 0x34, 0x8C, 0xFF,
+    0xFF, 0x07, 0xE7, 0x1C, 0x94, 0x92, 0x52, 0x8A, 0x31, 0x86, 0x21, 0x04, 0x39, 0xC7, 0x6B, 0x6D,
+    0xE7, 0x1C, 0x8E, 0xFF, 0xFF, 0x01, 0x63, 0x0C, 0x84, 0x10, 0x8B, 0xFF, 0xFF, 0x02, 0xC6, 0x38,
+    0x39, 0xE7, 0xFF, 0xDF, 0x8A, 0xFF, 0xFF, 0x01, 0x6B, 0x6D, 0x84, 0x10, 0x88, 0xFF, 0xFF, 0x02,
+    0xEF, 0x7D, 0x7B, 0xEF, 0x42, 0x08, 0x83, 0x21, 0x04, 0x00, 0x73, 0xAE, 0x85, 0xFF, 0xFF, 0x02,
+    0xB5, 0xB6, 0x31, 0xA6, 0xFF, 0xDF, 0x87, 0xFF, 0xFF, 0x02, 0xEF, 0x5D, 0x39, 0xC7, 0xCE, 0x59,
+    0xD5, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80,
+    0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x80, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBA, 0xFF, 0xFF, 0xFF, 0xEF, 0x7D, 0xFF, 0xEF, 0x7D, 0xBD, 0xEF, 0x7D,
+};
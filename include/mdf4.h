@@ -0,0 +1,72 @@
+#pragma once
+#include "frame_reader.h"
+#ifdef ARDUINO
+#include "log_writer.h"
+#endif
+
+// ASAM MDF 4.11 bus logging file (.mf4) with a single sorted data group:
+// one CAN_DataFrame channel group whose 23 byte records hold a float64
+// timestamp in seconds followed by BusChannel, ID/IDE, DLC, DataLength and
+// DataBytes. All metadata blocks are written once at the start of a file,
+// padded so the data block payload begins on a sector boundary; after that
+// the file only grows by whole sectors. Remote and error frames have no
+// place in this group and are not stored.
+//
+// The file is marked unfinalized ("UnFinMF ") while recording, so tools can
+// still recover a file cut by a power loss. When it reaches
+// MDF_ROTATE_MB, and at the end of the session, the data block length, the
+// record count and the identification block are filled in and recording
+// continues in a new file; if that cannot be opened the remaining frames
+// are dropped and counted. Mf4Reader replays these files, finalized or not;
+// MDF files of other tools are not supported.
+
+#ifndef MDF_ROTATE_MB
+#define MDF_ROTATE_MB 256
+#endif
+
+#define MDF_RECORD_SIZE 23
+#define MDF_META_MAX 4096 // metadata image, about 2.5 KB are used
+
+// Link counts of the blocks written
+#define MDF_HD_LINKS 6
+#define MDF_FH_LINKS 2
+#define MDF_DG_LINKS 4
+#define MDF_CG_LINKS 6
+#define MDF_CN_LINKS 8
+#define MDF_SI_LINKS 3
+
+#ifdef ARDUINO
+class Mf4Writer : public LogWriter
+{
+public:
+    bool begin() override;
+    void write(const CanFrame& frame) override;
+    void flush() override;
+    void end() override;
+
+private:
+    bool openFile();
+    void finalize();
+
+    File file;
+    char buffer[BUFFER_SIZE];
+    size_t used = 0;
+    uint64_t dataOffset = 0; // of the DT block
+    uint64_t cycleOffset = 0; // of cg_cycle_count
+    uint64_t records = 0;
+    unsigned long skipped = 0;
+    unsigned long lost = 0; // frames after a failed rotation
+};
+#endif
+
+class Mf4Reader : public FrameReader
+{
+public:
+    using FrameReader::FrameReader;
+    bool begin();
+    bool next(CanFrame& frame) override;
+    const char* name() const override { return "mf4"; }
+
+private:
+    uint64_t remaining = 0;
+};
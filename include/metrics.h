@@ -0,0 +1,109 @@
+#pragma once
+#include "log_histogram.h"
+
+// Named counters, gauges and histograms of the pipeline tasks, read by the
+// status screen, the telemetry, the replay report and the "metrics" serial
+// command.
+//
+// Every core has its own slot of each counter and histogram, in a block
+// aligned to METRIC_ALIGN so the cores never write the same cache line, and
+// an update only touches the slot of the core it runs on: a plain add, no
+// atomics and no locks. Reads add up the slots of all cores. Each counter
+// and histogram has one writing task per core, so no read-modify-write is
+// ever interrupted by another writer of the same slot. A gauge has a single
+// writer and is one aligned word, stored and loaded whole.
+//
+// A counter slot is 32 bit, one word the other core never sees half
+// written. metricCount() folds the slots into 64-bit totals; that holds as
+// long as every counter is read at least once per 2^32 updates of a core,
+// which the telemetry task does every TELEMETRY_PERIOD_MS. A read while the
+// tasks keep counting may lag behind by the updates in flight.
+
+#define METRIC_ALIGN 32 // cache line of the flash/PSRAM cache
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#define METRIC_CORES portNUM_PROCESSORS
+#define METRIC_CORE() xPortGetCoreID()
+#else
+#define METRIC_CORES 1 // host build
+#define METRIC_CORE() 0
+#endif
+
+enum MetricCounter : uint8_t
+{
+    METRIC_RECEIVED,            // frames received (record)
+    METRIC_DROPPED,             // frames lost because the queue was full
+    METRIC_FILTERED,            // frames dropped by the ID filter
+    METRIC_UNCHANGED,           // unchanged frames not written
+    METRIC_TRANSMITTED,         // frames sent (replay)
+    METRIC_LATE,                // frames too late for the reorder window
+    METRIC_EARLY,               // frames handed off before their time
+    METRIC_TIMING_ERROR_SUM_US, // sum of |actual - logged| gaps
+    METRIC_TIMING_ERROR_COUNT,  // gaps summed
+    METRIC_LZ4_BLOCKS,
+    METRIC_LZ4_IN_BYTES,
+    METRIC_LZ4_OUT_BYTES,
+    METRIC_LZ4_MICROS,          // time spent in lz4Compress
+    METRIC_EVENTS_DROPPED,      // telemetry events lost to a full queue
+    METRIC_REANCHORS,           // replay schedule moved after a stall
+    METRIC_COUNTERS
+};
+
+enum MetricGauge : uint8_t
+{
+    GAUGE_HEAP_FREE,
+    GAUGE_HEAP_LARGEST,
+    GAUGE_HEAP_MIN_FREE,
+    GAUGE_PSRAM_FREE,
+    GAUGE_PSRAM_LARGEST,
+    GAUGE_PSRAM_MIN_FREE,
+    GAUGE_STACK_FREE_MIN,  // bytes, least of all tasks
+    GAUGE_CPU0_PERMILLE,   // RESOURCE_UNKNOWN when not available
+    GAUGE_CPU1_PERMILLE,
+    METRIC_GAUGES
+};
+
+enum MetricHistogram : uint8_t
+{
+    HIST_SCHEDULE_DEVIATION, // us, |hand-off - scheduled time| per frame
+    METRIC_HISTOGRAMS
+};
+
+struct alignas(METRIC_ALIGN) MetricSlot
+{
+    uint32_t counters[METRIC_COUNTERS];
+    LogHistogram histograms[METRIC_HISTOGRAMS];
+};
+
+extern MetricSlot metricSlots[METRIC_CORES];
+extern volatile uint32_t metricGauges[METRIC_GAUGES];
+
+inline void metricAdd(MetricCounter counter, uint32_t n = 1)
+{
+    metricSlots[METRIC_CORE()].counters[counter] += n;
+}
+
+inline void metricSet(MetricGauge gauge, uint32_t value)
+{
+    metricGauges[gauge] = value;
+}
+
+inline void metricRecord(MetricHistogram histogram, uint32_t value)
+{
+    metricSlots[METRIC_CORE()].histograms[histogram].record(value);
+}
+
+inline uint32_t metricGauge(MetricGauge gauge)
+{
+    return metricGauges[gauge];
+}
+
+uint64_t metricCount(MetricCounter counter);
+// Zeroes all counters and histograms, for the host tests
+void metricReset();
+// All cores merged into out
+void metricHistogram(MetricHistogram histogram, LogHistogram& out);
+
+// Registers the "metrics" serial command
+void beginMetrics();
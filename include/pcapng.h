@@ -0,0 +1,80 @@
+#pragma once
+#include "frame_reader.h"
+#ifdef ARDUINO
+#include "log_writer.h"
+#endif
+
+// pcapng (https://www.ietf.org/archive/id/draft-ietf-opsawg-pcapng-02.html)
+// with LINKTYPE_CAN_SOCKETCAN, which Wireshark dissects directly. The writer
+// emits a section header, one interface description for can0 and then an
+// enhanced packet block per frame, collected in a sector-sized buffer. At
+// every flush an interface statistics block records received, filtered and
+// dropped frame counts, so losses show up in Wireshark's capture info.
+// The reader accepts any pcapng file with SocketCAN interfaces in either
+// byte order and skips all other blocks and link types.
+
+#define PCAPNG_SHB 0x0A0D0D0AUL
+#define PCAPNG_IDB 0x00000001UL
+#define PCAPNG_EPB 0x00000006UL
+#define PCAPNG_ISB 0x00000005UL
+#define PCAPNG_BYTE_ORDER 0x1A2B3C4DUL
+#define LINKTYPE_CAN_SOCKETCAN 227
+#define SOCKETCAN_FRAME_SIZE 16
+
+#define PCAPNG_OPT_END 0
+#define PCAPNG_OPT_IF_NAME 2
+#define PCAPNG_OPT_IF_TSRESOL 9
+#define PCAPNG_OPT_IF_TSOFFSET 14
+#define PCAPNG_OPT_ISB_IFRECV 4
+#define PCAPNG_OPT_ISB_FILTERACCEPT 6
+#define PCAPNG_OPT_ISB_OSDROP 7
+
+#ifndef PCAPNG_MAX_INTERFACES
+#define PCAPNG_MAX_INTERFACES 8
+#endif
+
+#ifdef ARDUINO
+class PcapngWriter : public LogWriter
+{
+public:
+    bool begin() override;
+    void write(const CanFrame& frame) override;
+    void flush() override;
+    void end() override;
+
+private:
+    void append(const uint8_t* data, size_t n);
+    void writeStatistics();
+
+    File file;
+    char buffer[BUFFER_SIZE];
+    size_t used = 0;
+    int64_t lastTimestamp = 0;
+};
+#endif
+
+class PcapngReader : public FrameReader
+{
+public:
+    using FrameReader::FrameReader;
+    bool next(CanFrame& frame) override;
+    const char* name() const override { return "pcapng"; }
+
+private:
+    struct Interface
+    {
+        bool socketcan;
+        uint8_t tsresol;  // pcapng if_tsresol
+        int64_t tsoffset; // seconds
+    };
+
+    uint32_t get32(const uint8_t* p) const;
+    uint16_t get16(const uint8_t* p) const;
+    void skip(size_t n);
+    void readInterface(const uint8_t* body, size_t n);
+    int64_t toMicros(const Interface& itf, uint64_t ts) const;
+
+    bool swapped = false;
+    Interface interfaces[PCAPNG_MAX_INTERFACES];
+    uint8_t interfaceCount = 0;
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+// Record mode: CANReceiveTask (core 1) drains the MCP2515 into a frame queue,
+// LogWriterTask (core 0) hands the frames to the LogWriter selected by
+// LOG_FORMAT, so SD latency never stalls the controller.
+// Received, dropped and filtered frames are counted in the metrics
+// registry.
+
+bool startRecorder();
+// Flush and close the current log, e.g. before powering off
+void stopRecorder();
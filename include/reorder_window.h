@@ -0,0 +1,35 @@
+#pragma once
+#include "can_frame.h"
+
+// Bounded reorder window for logs with small timestamp inversions, such as
+// merged multi-interface candump output. Frames pass through a min-heap of
+// REORDER_DEPTH frames keyed on timestamp, then file order, and leave in
+// timestamp order. A frame older than one already released arrived too late
+// for the window; it is released at once and counted as METRIC_LATE.
+
+#ifndef REORDER_DEPTH
+#define REORDER_DEPTH 64 // frames held back, 0 disables reordering
+#endif
+
+class ReorderWindow
+{
+public:
+    // Add a frame; returns true with the oldest frame in out once the window
+    // is full
+    bool push(const CanFrame& frame, CanFrame& out);
+    // Release the remaining frames in order at the end of the log
+    bool pop(CanFrame& out);
+
+private:
+    bool earlier(uint16_t a, uint16_t b) const;
+    void siftUp(uint16_t i);
+    void siftDown(uint16_t i);
+    void release(const CanFrame& frame, CanFrame& out);
+
+    CanFrame slots[REORDER_DEPTH > 0 ? REORDER_DEPTH : 1];
+    uint32_t order[REORDER_DEPTH > 0 ? REORDER_DEPTH : 1];
+    uint16_t heap[REORDER_DEPTH > 0 ? REORDER_DEPTH : 1]; // slot numbers
+    uint16_t count = 0;
+    uint32_t sequence = 0;
+    int64_t lastReleased = INT64_MIN;
+};
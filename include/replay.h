@@ -0,0 +1,19 @@
+#pragma once
+#include <SD.h>
+#include "config.h"
+
+// Replay mode: LogReaderTask (core 0) reads the log through a LogSource and
+// a FrameReader and queues the frames; CANTransmitTask (core 1) sends them with
+// the original timing. SD reads and decompression therefore never hold up
+// a transmission.
+
+// Per frame |hand-off to the controller - scheduled time| goes to the
+// HIST_SCHEDULE_DEVIATION metric, the schedule being the log's time line
+// anchored at the first frame and moved up after a stall (see ReplayEngine).
+// At the end of a replay a summary is appended to REPLAY_REPORT_PATH.
+
+#ifndef REPLAY_REPORT_PATH
+#define REPLAY_REPORT_PATH LOG_DIR "/replay_timing.txt"
+#endif
+
+bool startReplay(File& file);
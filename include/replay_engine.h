@@ -0,0 +1,75 @@
+#pragma once
+#include "can_frame.h"
+
+// Timing and transmit side of the replay, kept apart from the hardware so
+// it also builds for the host (env:native, tests in test/). The engine
+// sends frames through a CanController with the log's timing taken from a
+// ReplayClock; on the device these are the MCP2515 transmit path and
+// esp_timer with vTaskDelay, in the tests mocks with a simulated clock.
+
+#ifdef ARDUINO
+#include <mcp_can_dfs.h>
+#else
+// Status codes of mcp_can_dfs.h
+#define CAN_OK 0
+#define CAN_GETTXBFTIMEOUT 6
+#define CAN_FAIL 0xFF
+#endif
+
+#ifndef REPLAY_TX_ATTEMPTS
+#define REPLAY_TX_ATTEMPTS 5
+#endif
+
+#ifndef REPLAY_MAX_BEHIND_US
+#define REPLAY_MAX_BEHIND_US 20000 // re-anchor the schedule beyond this, 0 never
+#endif
+
+#ifndef REPLAY_BUSY_WAIT_US
+#define REPLAY_BUSY_WAIT_US 10000 // before trying a busy controller again
+#endif
+
+class CanController
+{
+public:
+    virtual ~CanController() {}
+    // CAN_OK, CAN_GETTXBFTIMEOUT while the controller is busy, or another
+    // mcp_can status on failure
+    virtual uint8_t transmit(const CanFrame& frame) = 0;
+};
+
+class ReplayClock
+{
+public:
+    virtual ~ReplayClock() {}
+    virtual int64_t nowUs() = 0;
+    // Sleep for about us, may round down to the resolution of the clock
+    virtual void sleepUs(int64_t us) = 0;
+};
+
+// Puts each frame on the bus at its place on the log's time line, anchored
+// at the first frame, so wait errors do not add up. When a stall (a busy
+// bus, a slow SD read) leaves the engine more than REPLAY_MAX_BEHIND_US
+// behind, the time line is moved to the current frame instead of sending
+// the overdue frames back to back, and METRIC_REANCHORS counts it. Frames
+// older than the one before (late out of the reorder window) are sent at
+// once and leave the time line alone. Each
+// hand-off records its deviation from the schedule and the error of the gap
+// to the previous frame in the metrics (HIST_SCHEDULE_DEVIATION,
+// METRIC_EARLY, METRIC_TIMING_ERROR_*).
+class ReplayEngine
+{
+public:
+    ReplayEngine(CanController& can, ReplayClock& clock) : can(can), clock(clock) {}
+    // Wait for the frame's time and send it, retrying a busy controller up
+    // to REPLAY_TX_ATTEMPTS times. Returns the status of the last attempt.
+    uint8_t send(const CanFrame& frame);
+
+private:
+    void recordTiming(int64_t scheduledUs, int64_t loggedGap);
+
+    CanController& can;
+    ReplayClock& clock;
+    int64_t lastTimestamp = -1;
+    int64_t lastSentUs = -1;
+    int64_t scheduleOffsetUs = 0; // log time to clock time
+};
@@ -0,0 +1,41 @@
+#pragma once
+#include <stdint.h>
+
+// System resources, sampled by the telemetry task every TELEMETRY_PERIOD_MS
+// and shown on the status screen: CPU load per core and per task from the
+// FreeRTOS run-time stats, the stack high-water mark of every task, and
+// free, largest free block and minimum ever free of internal RAM and PSRAM.
+// A largest block far below the free size means fragmentation. The figures
+// for the whole system are gauges of the metrics registry, the per task
+// table is kept here.
+//
+// Per task CPU load needs an Arduino core built with
+// CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS. The stock core is not, then the
+// load per core comes from idle hooks counting the cycles the idle task of
+// each core had, and per task load reads as unknown.
+
+#define RESOURCE_MAX_TASKS 32
+#define RESOURCE_NAME_LEN 16
+#define RESOURCE_UNKNOWN 0xFFFF
+
+struct TaskResources
+{
+    char name[RESOURCE_NAME_LEN];
+    uint8_t core;           // 0xFF when not pinned
+    uint16_t cpuPermille;   // of one core since the last sample
+    uint32_t stackFreeMin;  // bytes of stack never used
+};
+
+struct ResourceSnapshot
+{
+    uint8_t taskCount;
+    TaskResources tasks[RESOURCE_MAX_TASKS];
+};
+
+// Written by sampleResources() only, other tasks may see a sample half
+// updated
+extern ResourceSnapshot resources;
+
+// Installs the idle hooks when the core has no run-time stats
+void beginResourceMonitor();
+void sampleResources();
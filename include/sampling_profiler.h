@@ -0,0 +1,32 @@
+#pragma once
+#include <stdint.h>
+
+// Statistical profiler. A hardware timer per core interrupts at
+// PROFILER_HZ; the interrupt takes the program counter and the return
+// address of the interrupted code from the exception frame the FreeRTOS
+// port saves for it, plus the running task, and stores them in a PSRAM
+// buffer of PROFILER_SAMPLES per core. Samples taken while another
+// interrupt was running have no PC.
+//
+// Serial commands: "profile start" clears the buffers and samples until
+// they are full, "profile stop" ends early, "profile" prints the samples.
+// tools/profile_symbolize.py maps them to functions of the firmware ELF.
+//
+// With SAMPLING_PROFILER=0 (the default) nothing is compiled in.
+
+#ifndef SAMPLING_PROFILER
+#define SAMPLING_PROFILER 0
+#endif
+
+#ifndef PROFILER_HZ
+#define PROFILER_HZ 2000
+#endif
+
+#ifndef PROFILER_SAMPLES
+#define PROFILER_SAMPLES 16384 // per core
+#endif
+
+#define PROFILER_TIMER 2 // hardware timers PROFILER_TIMER and the next
+
+// Registers the "profile" serial command and sets up the timers
+void beginSamplingProfiler();
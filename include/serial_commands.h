@@ -0,0 +1,14 @@
+#pragma once
+
+// Line commands on the serial port, e.g. "stages" + Enter. Modules register
+// a handler at startup; pollSerialCommands() runs from loop() and never
+// blocks. "help" lists the registered commands.
+
+#define SERIAL_COMMAND_MAX 16
+#define SERIAL_LINE_MAX 64
+
+// args points at the text after the command word, "" if none
+typedef void (*SerialCommandHandler)(const char* args);
+
+void registerCommand(const char* name, const char* help, SerialCommandHandler handler);
+void pollSerialCommands();
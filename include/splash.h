@@ -0,0 +1,12 @@
+#pragma once
+
+// Boot splash. The logo is stored run-length coded (include/m5_logo_rle.h,
+// generated by tools/logo_compress.py) and decoded SPLASH_CHUNK_ROWS rows
+// at a time into two DMA buffers: while one chunk is sent to the LCD the
+// next is decoded.
+
+#ifndef SPLASH_CHUNK_ROWS
+#define SPLASH_CHUNK_ROWS 16
+#endif
+
+void drawSplash();
@@ -0,0 +1,42 @@
+#pragma once
+#include <stdint.h>
+#include "log_histogram.h"
+
+// Cycle-count profile of the replay pipeline. Each stage is timed with the
+// Xtensa CCOUNT register and kept in a LogHistogram, so the serial command
+// "stages" can print min/mean/max/p99 per stage ("stages reset" starts
+// over). A stage is always timed on one core, where CCOUNT is consistent,
+// and written by one task only.
+//
+// With PROFILE_STAGES=0 (the default) the macros expand to nothing.
+
+#ifndef PROFILE_STAGES
+#define PROFILE_STAGES 0
+#endif
+
+enum Stage : uint8_t
+{
+    STAGE_READ,     // LogSource reads: SD and decompression (LogReaderTask)
+    STAGE_PARSE,    // FrameReader::next without the reads (LogReaderTask)
+    STAGE_WAIT,     // inter-frame delay (CANTransmitTask)
+    STAGE_SPI_LOAD, // TX buffer load and RTS (CANTransmitTask)
+    STAGE_TX_DONE,  // wait for the previous frame to leave (CANTransmitTask)
+    STAGE_COUNT
+};
+
+#if PROFILE_STAGES
+#include <xtensa/hal.h>
+#define STAGE_START(t) uint32_t t = xthal_get_ccount()
+#define STAGE_END(stage, t) recordStage(stage, xthal_get_ccount() - (t))
+
+void recordStage(uint8_t stage, uint32_t cycles);
+// Cycles recorded for a stage so far, wraps around
+uint32_t stageCycles(uint8_t stage);
+const LogHistogram& stageHistogram(uint8_t stage);
+#else
+#define STAGE_START(t)
+#define STAGE_END(stage, t)
+#endif
+
+// Registers the "stages" serial command
+void beginStageProfiler();
@@ -0,0 +1,22 @@
+#pragma once
+#include <M5Unified.h>
+
+// Status display. A UI task on core 0 samples the counters once per
+// DISPLAY_PERIOD_MS and feeds the bus graph (bus_graph.h), renders each field into its own M5Canvas sprite and
+// pushes a field to the LCD only when its text changed, in DMA transfers of
+// DISPLAY_CHUNK_ROWS rows. The LCD shares the SPI bus with the MCP2515 and
+// the SD card; short transfers leave the bus free for the CAN task between
+// them, and nothing on core 1 draws anymore.
+
+#ifndef DISPLAY_PERIOD_MS
+#define DISPLAY_PERIOD_MS 1000
+#endif
+
+#ifndef DISPLAY_CHUNK_ROWS
+#define DISPLAY_CHUNK_ROWS 8
+#endif
+
+void startStatusDisplay(bool recordMode);
+
+// Push a 16 bit sprite to the LCD in DISPLAY_CHUNK_ROWS row DMA transfers
+void pushSpriteDMA(M5Canvas& sprite, int16_t x, int16_t y);
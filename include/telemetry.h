@@ -0,0 +1,182 @@
+#pragma once
+#include <stdint.h>
+
+// Binary telemetry on the serial port, decoded on the host by
+// tools/telemetry_decode.py. A low priority task on core 0 sends the
+// counters and the system resources every TELEMETRY_PERIOD_MS, the
+// histograms and the per task resources every TELEMETRY_HISTOGRAM_PERIOD
+// counter messages, and the events queued by telemetryEvent() as they
+// come. Only that task writes to the UART, so a full UART FIFO never holds
+// up the CAN tasks.
+//
+// A message is <type> <sequence> <payload> <CRC-16/CCITT of all before>,
+// little-endian, COBS encoded and framed by a zero byte on both sides.
+// Only the replies of serial commands are sent as text, between frames; a
+// receiver that lost sync resumes at the next zero.
+
+#ifndef TELEMETRY_BAUD
+#define TELEMETRY_BAUD 921600
+#endif
+
+#ifndef TELEMETRY_PERIOD_MS
+#define TELEMETRY_PERIOD_MS 1000
+#endif
+
+#define TELEMETRY_HISTOGRAM_PERIOD 5
+#define TELEMETRY_EVENT_QUEUE 32
+#define TELEMETRY_MAX_MESSAGE 1024
+
+enum TelemetryType : uint8_t
+{
+    TELEMETRY_COUNTERS = 1,  // mode, count, count x u64 (TelemetryCounter order)
+    TELEMETRY_HISTOGRAM = 2, // id, count, min, max, sum (u64), n, n x (bucket, u32)
+    TELEMETRY_EVENT = 3,     // time ms, code, detail, arg
+    TELEMETRY_TASKS = 4,     // n, n x (name[16], core, CPU per mille u16, stack free u32)
+};
+
+// Appended only, the decoder names counters by position
+enum TelemetryCounter : uint8_t
+{
+    COUNTER_UPTIME_MS,
+    COUNTER_FREE_HEAP,
+    COUNTER_RECEIVED,
+    COUNTER_DROPPED,
+    COUNTER_FILTERED,
+    COUNTER_UNCHANGED,
+    COUNTER_TRANSMITTED,
+    COUNTER_LATE,
+    COUNTER_EARLY,
+    COUNTER_TIMING_ERROR_SUM_US,
+    COUNTER_TIMING_ERROR_COUNT,
+    COUNTER_LZ4_BLOCKS,
+    COUNTER_LZ4_IN_BYTES,
+    COUNTER_LZ4_OUT_BYTES,
+    COUNTER_LZ4_MICROS,
+    COUNTER_EVENTS_DROPPED,
+    COUNTER_HEAP_LARGEST,
+    COUNTER_HEAP_MIN_FREE,
+    COUNTER_PSRAM_FREE,
+    COUNTER_PSRAM_LARGEST,
+    COUNTER_PSRAM_MIN_FREE,
+    COUNTER_STACK_FREE_MIN,
+    COUNTER_CPU0_PERMILLE, // 0xFFFF when unknown
+    COUNTER_CPU1_PERMILLE,
+    COUNTER_REANCHORS,
+    COUNTER_COUNT
+};
+
+enum TelemetryHistogramId : uint8_t
+{
+    HISTOGRAM_SCHEDULE_DEVIATION, // us
+    HISTOGRAM_STAGE,              // + Stage, CPU cycles
+};
+
+// Appended only, like the details below
+enum TelemetryEventCode : uint8_t
+{
+    EVENT_TX_ERROR = 1,     // detail = MCP_CAN status, arg = CAN ID, bit 31 set if extended
+    EVENT_BOOT = 2,         // detail = BootPhase, arg = ms since reset at its end
+    EVENT_FIRST_FRAME = 3,  // detail = 1 when later than BOOT_TARGET_MS, arg = ms since reset
+    EVENT_REPLAY = 4,       // detail = ReplayEvent
+    EVENT_RECORDING = 5,    // detail = RecordingEvent
+    EVENT_TRIGGER = 6,      // detail = TriggerEvent
+    EVENT_FLIGHT = 7,       // detail = FlightEvent
+    EVENT_MF4 = 8,          // detail = Mf4Event
+    EVENT_SOURCE = 9,       // detail = SourceEvent
+    EVENT_READER = 10,      // detail = ReaderEvent
+    EVENT_ID_FILTER = 11,   // detail = IdFilterEvent
+    EVENT_UNAVAILABLE = 12, // detail = Feature, off for want of memory or hooks
+    EVENT_POWER_OFF = 13,
+};
+
+enum BootPhase : uint8_t
+{
+    BOOT_DISPLAY,
+    BOOT_SPLASH,
+    BOOT_SD,
+    BOOT_SCAN,
+    BOOT_CAN,
+    BOOT_READY,
+};
+
+enum ReplayEvent : uint8_t
+{
+    REPLAY_FILE_FOUND,    // arg = file size
+    REPLAY_CANNOT_DECODE, // no LogSource for the file
+    REPLAY_CANNOT_PARSE,  // no FrameReader for the file
+    REPLAY_STARTED,
+    REPLAY_FINISHED,      // arg = frames transmitted
+    REPLAY_NO_REPORT,     // REPLAY_REPORT_PATH could not be opened
+};
+
+enum RecordingEvent : uint8_t
+{
+    RECORDING_FILE,        // arg = number of the new log file
+    RECORDING_OPEN_FAILED,
+    RECORDING_STOPPED,
+};
+
+enum TriggerEvent : uint8_t
+{
+    TRIGGER_ARMED,     // arg = TRIGGER_PRE_MS
+    TRIGGER_BY_FRAME,  // arg = buffered frames flushed
+    TRIGGER_BY_ERROR,  // arg = buffered frames flushed
+    TRIGGER_BY_BUTTON, // arg = buffered frames flushed
+    TRIGGER_COMPLETE,
+    TRIGGER_OVERRUN,   // arg = frames lost so far
+};
+
+enum FlightEvent : uint8_t
+{
+    FLIGHT_CREATED,       // arg = FLIGHT_FILE_MB
+    FLIGHT_RESUMED,       // arg = block the ring goes on at
+};
+
+enum Mf4Event : uint8_t
+{
+    MF4_ROTATE_FAILED, // the next file could not be opened, recording stopped
+    MF4_SKIPPED,       // arg = remote/error frames not stored in the file
+    MF4_LOST,          // arg = frames lost after a file error
+};
+
+enum SourceEvent : uint8_t
+{
+    SOURCE_LZ4_BLOCK_SIZE, // arg = block size in KB, compress with lz4 -B4 or -B5
+    SOURCE_LZ4_CORRUPT,
+    SOURCE_GZIP_ERROR,     // arg = tinfl status
+};
+
+enum ReaderEvent : uint8_t
+{
+    READER_FOREIGN_MF4,   // MF4 file not written by this logger
+    READER_BLF_TOO_LARGE, // arg = container size
+    READER_BLF_INFLATE,   // arg = inflate status
+};
+
+enum IdFilterEvent : uint8_t
+{
+    ID_FILTER_LOADED,    // arg = standard IDs | extended IDs << 16
+    ID_FILTER_NO_HASH,   // extended IDs dropped, the hash could not be built
+    ID_FILTER_RXB0_MASK, // arg = mask
+    ID_FILTER_RXB1_MASK, // arg = mask
+    ID_FILTER_ACCEPTED,  // arg = IDs the masks let through, saturated
+};
+
+enum Feature : uint8_t
+{
+    FEATURE_CHANGE_FILTER, // no internal RAM for the table
+    FEATURE_TRIGGER,       // no PSRAM for the ring
+    FEATURE_TRACE,         // no PSRAM for the trace buffer
+    FEATURE_PROFILER,      // no PSRAM for the samples
+    FEATURE_CPU_LOAD,      // no idle hooks
+};
+
+// Queues an event for the telemetry task. Never blocks: when the queue is
+// full the event is dropped and counted. Events queued during boot wait
+// for startTelemetry().
+void telemetryEvent(uint8_t code, uint8_t detail, uint32_t arg);
+
+// Creates the event queue, first thing in setup()
+void beginTelemetry();
+
+void startTelemetry(bool recordMode);
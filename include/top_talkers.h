@@ -0,0 +1,85 @@
+#pragma once
+#include "can_frame.h"
+
+// Heavy-hitter counting of CAN IDs for the top-talkers table, after the
+// space-saving algorithm: a fixed number of counters, and an ID without a
+// counter takes over the smallest one and continues from its count, so
+// frequent IDs are never pushed out by a stream of rare ones. To keep the
+// update constant time the table is set associative: an ID hashes to one
+// set of TOP_TALKERS_WAYS counters and competes only within that set, four
+// entries in adjacent memory.
+//
+// count() runs on the hot path of the one task that sees every frame
+// (receive in record mode, transmit in replay mode). The UI reads the
+// counters without a lock; a counter being replaced may show stale for one
+// refresh.
+
+#ifndef TOP_TALKERS_SIZE
+#define TOP_TALKERS_SIZE 256 // counters, a power of two
+#endif
+
+#define TOP_TALKERS_WAYS 4
+
+#ifndef TOP_TALKERS_SHOWN
+#define TOP_TALKERS_SHOWN 6 // rows on the screen
+#endif
+
+struct TalkerEntry
+{
+    uint32_t key;    // id, bit 31 set for extended
+    uint32_t frames; // frame count, inherited from the previous owner
+    uint32_t bits;   // nominal frame bits, inherited as well
+};
+
+class TopTalkers
+{
+public:
+    void count(const CanFrame& frame)
+    {
+        uint32_t bits = frameBits(frame);
+        bitCount += bits;
+        uint32_t key = frame.id | ((frame.flags & CAN_FRAME_EXT) ? 0x80000000UL : 0);
+        TalkerEntry* set = table + (hashKey(key) & (TOP_TALKERS_SIZE / TOP_TALKERS_WAYS - 1)) * TOP_TALKERS_WAYS;
+        TalkerEntry* smallest = set;
+        for (uint8_t i = 0; i < TOP_TALKERS_WAYS; i++)
+        {
+            if (set[i].key == key && set[i].frames)
+            {
+                set[i].frames++;
+                set[i].bits += bits;
+                return;
+            }
+            if (set[i].frames < smallest->frames) smallest = &set[i];
+        }
+        smallest->key = key;
+        smallest->frames++;
+        smallest->bits += bits;
+    }
+
+    const TalkerEntry* entries() const { return table; }
+    // Bits of all counted frames, wraps around
+    uint32_t totalBits() const { return bitCount; }
+
+    // Bits on the wire without stuffing: 47 for a standard frame, 67 for an
+    // extended one, plus the data field
+    static uint32_t frameBits(const CanFrame& frame)
+    {
+        uint32_t bits = (frame.flags & CAN_FRAME_EXT) ? 67 : 47;
+        if (!(frame.flags & CAN_FRAME_RTR)) bits += frame.len * 8;
+        return bits;
+    }
+
+private:
+    static uint32_t hashKey(uint32_t key)
+    {
+        key ^= key >> 16;
+        key *= 0x85EBCA6BU;
+        key ^= key >> 13;
+        return key;
+    }
+
+    TalkerEntry table[TOP_TALKERS_SIZE] = {};
+    uint32_t bitCount = 0;
+};
+
+extern TopTalkers topTalkers;
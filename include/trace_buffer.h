@@ -0,0 +1,62 @@
+#pragma once
+#include <stdint.h>
+
+// Event trace for timeline analysis. Each core has its own ring of
+// TRACE_EVENTS records in PSRAM; a record takes its slot with one atomic
+// add on the ring head of the core it runs on, so tasks and interrupts
+// never wait for each other and the other core is never involved.
+// Timestamps are esp_timer microseconds, the same clock on both cores.
+//
+// The serial command "trace" prints both rings ("trace N" only the last N
+// events per core, "trace clear" empties them); tools/trace_to_chrome.py
+// turns the capture into Chrome trace / Perfetto JSON.
+//
+// The FreeRTOS of the Arduino core is prebuilt without trace hooks, so
+// task switches are recorded by the tasks themselves: TRACE_TASK_WAIT
+// before each blocking call and TRACE_TASK_RUN after it.
+//
+// With TRACE_BUFFER=0 (the default) the macros expand to nothing.
+
+#ifndef TRACE_BUFFER
+#define TRACE_BUFFER 0
+#endif
+
+#ifndef TRACE_EVENTS
+#define TRACE_EVENTS 16384 // per core, power of two
+#endif
+
+enum TraceEvent : uint8_t
+{
+    TRACE_TASK_RUN,      // arg = TraceTask
+    TRACE_TASK_WAIT,     // arg = TraceTask
+    TRACE_ISR,           // CAN interrupt
+    TRACE_SD_READ_BEGIN, // arg = bytes requested
+    TRACE_SD_READ_END,   // arg = bytes read
+    TRACE_SD_SYNC_BEGIN, // log file flush
+    TRACE_SD_SYNC_END,
+    TRACE_TX_START,      // RTS sent, arg = CAN ID, bit 31 set if extended
+    TRACE_TX_FREE,       // the next send found TXB0 empty, not polled
+                         // earlier, so only an upper bound of the end of
+                         // the previous frame on the wire
+};
+
+enum TraceTask : uint8_t
+{
+    TRACE_LOOP,
+    TRACE_RECEIVE,
+    TRACE_WRITER,
+    TRACE_READER,
+    TRACE_TRANSMIT,
+    TRACE_UI,
+};
+
+#if TRACE_BUFFER
+#define TRACE(event, arg) traceEvent(event, arg)
+
+void traceEvent(uint8_t event, uint32_t arg);
+#else
+#define TRACE(event, arg)
+#endif
+
+// Allocates the rings and registers the "trace" serial command
+void beginTraceBuffer();
@@ -0,0 +1,68 @@
+#pragma once
+#include "log_writer.h"
+
+// Pre-trigger capture: every received frame goes into a ring in PSRAM and
+// nothing reaches the SD card until a trigger fires. The capture then covers
+// TRIGGER_PRE_MS before the trigger up to TRIGGER_POST_MS after the last
+// trigger. Triggers are
+//  - a frame matching TRIGGER_ID and/or TRIGGER_DATA under TRIGGER_MASK,
+//    payload bytes compared MSB first, e.g.
+//    -DTRIGGER_ID=0x7E8 -DTRIGGER_DATA=0x0341000000000000 -DTRIGGER_MASK=0xFFFF000000000000
+//  - an error frame reported by the controller (TRIGGER_ON_ERROR)
+//  - BtnC, through requestTrigger()
+//
+// The ring also serves as the flush queue: while capturing, each write hands
+// at most TRIGGER_DRAIN_BATCH buffered frames to the sink, so a trigger never
+// stalls the writer task long enough to overflow the frame queue.
+
+#ifndef TRIGGER_RING_FRAMES
+#define TRIGGER_RING_FRAMES 65536 // power of two, 1.5 MB of PSRAM
+#endif
+
+#ifndef TRIGGER_PRE_MS
+#define TRIGGER_PRE_MS 10000
+#endif
+
+#ifndef TRIGGER_POST_MS
+#define TRIGGER_POST_MS 5000
+#endif
+
+#ifndef TRIGGER_ON_ERROR
+#define TRIGGER_ON_ERROR 1
+#endif
+
+#if defined(TRIGGER_MASK) && !defined(TRIGGER_DATA)
+#define TRIGGER_DATA 0
+#endif
+
+#ifndef TRIGGER_DRAIN_BATCH
+#define TRIGGER_DRAIN_BATCH 64
+#endif
+
+class TriggerCapture : public LogWriter
+{
+public:
+    explicit TriggerCapture(LogWriter* sink) : sink(sink) {}
+    bool begin() override;
+    void write(const CanFrame& frame) override;
+    void flush() override;
+    void end() override;
+
+private:
+    bool matches(const CanFrame& frame) const;
+    void fire(int64_t when, uint8_t reason); // reason is a TriggerEvent
+    void checkButton();
+    void drain(uint32_t limit);
+
+    LogWriter* sink;
+    CanFrame* ring = nullptr;
+    uint32_t head = 0;   // next ring slot, counts up and wraps
+    uint32_t stored = 0; // valid frames behind head
+    uint32_t cursor = 0; // next frame for the sink, kept between captures
+    bool capturing = false;
+    int64_t captureEndUs = 0;
+    unsigned long overrun = 0;
+};
+
+// Fire a trigger from outside the writer task, e.g. on a button press
+void requestTrigger();
@@ -0,0 +1,142 @@
+#include "asc.h"
+#include "candump.h"
+
+static bool startsWith(const char* p, const char* end, const char* word)
+{
+    size_t n = strlen(word);
+    return (size_t)(end - p) >= n && memcmp(p, word, n) == 0;
+}
+
+static const char* skipSpaces(const char* p, const char* end)
+{
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    return p;
+}
+
+bool isAscLog(const char* data, size_t n)
+{
+    const char* end = data + n;
+    const char* p = skipSpaces(data, end);
+    return startsWith(p, end, "date ") || startsWith(p, end, "base ") || startsWith(p, end, "Begin Triggerblock");
+}
+
+bool AscReader::next(CanFrame& frame)
+{
+    const char* line;
+    const char* lineEnd;
+    while (buffer->nextLine(line, lineEnd))
+    {
+        const char* p = skipSpaces(line, lineEnd);
+        if (p < lineEnd && *p >= '0' && *p <= '9')
+        {
+            if (parseMessage(p, lineEnd, frame)) return true;
+        }
+        else if (startsWith(p, lineEnd, "base "))
+        {
+            p = skipSpaces(p + 5, lineEnd);
+            base = startsWith(p, lineEnd, "dec") ? 10 : 16;
+            p = skipSpaces(p + 3, lineEnd);
+            if (startsWith(p, lineEnd, "timestamps ")) relative = startsWith(skipSpaces(p + 11, lineEnd), lineEnd, "relative");
+        }
+    }
+    return false;
+}
+
+bool AscReader::parseMessage(const char* p, const char* end, CanFrame& frame)
+{
+    // Seconds with up to six fraction digits, kept in integer microseconds
+    int64_t seconds = 0;
+    while (p < end && *p >= '0' && *p <= '9') seconds = seconds * 10 + (*p++ - '0');
+    int32_t micros = 0;
+    int digits = 0;
+    if (p < end && *p == '.')
+    {
+        p++;
+        while (p < end && *p >= '0' && *p <= '9')
+        {
+            if (digits++ < 6) micros = micros * 10 + (*p - '0');
+            p++;
+        }
+    }
+    while (digits++ < 6) micros *= 10;
+    int64_t timestamp = seconds * 1000000 + micros;
+    if (relative) timestamp += lastTimestamp;
+
+    // Channel number, CANFD and other event lines have a word here
+    p = skipSpaces(p, end);
+    if (p == end || *p < '0' || *p > '9') return false;
+    while (p < end && *p >= '0' && *p <= '9') p++;
+    p = skipSpaces(p, end);
+
+    if (startsWith(p, end, "ErrorFrame"))
+    {
+        frame.timestampUs = lastTimestamp = timestamp;
+        frame.id = 0;
+        frame.flags = CAN_FRAME_ERR;
+        frame.len = 0;
+        return true;
+    }
+
+    uint32_t id = 0;
+    const char* idStart = p;
+    if (base == 16)
+    {
+        while (p < end && hexValue[(uint8_t)*p] >= 0) id = (id << 4) | hexValue[(uint8_t)*p++];
+    }
+    else
+    {
+        while (p < end && *p >= '0' && *p <= '9') id = id * 10 + (*p++ - '0');
+    }
+    if (p == idStart) return false;
+    uint8_t flags = 0;
+    if (p < end && (*p == 'x' || *p == 'X'))
+    {
+        flags = CAN_FRAME_EXT;
+        p++;
+    }
+
+    // Direction, then d(ata) or r(emote)
+    p = skipSpaces(p, end);
+    if (!startsWith(p, end, "Rx") && !startsWith(p, end, "Tx")) return false;
+    p = skipSpaces(p + 2, end);
+    if (p == end) return false;
+    char type = *p++;
+    p = skipSpaces(p, end);
+    uint8_t dlc = 0;
+    if (p < end && *p >= '0' && *p <= '9') dlc = hexValue[(uint8_t)*p++];
+
+    if (type == 'r')
+    {
+        flags |= CAN_FRAME_RTR;
+    }
+    else if (type == 'd')
+    {
+        if (dlc > 8) return false;
+        for (uint8_t i = 0; i < dlc; i++)
+        {
+            p = skipSpaces(p, end);
+            uint32_t value = 0;
+            const char* start = p;
+            if (base == 16)
+            {
+                while (p < end && hexValue[(uint8_t)*p] >= 0) value = (value << 4) | hexValue[(uint8_t)*p++];
+            }
+            else
+            {
+                while (p < end && *p >= '0' && *p <= '9') value = value * 10 + (*p++ - '0');
+            }
+            if (p == start || value > 0xFF) return false;
+            frame.data[i] = value;
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    frame.timestampUs = lastTimestamp = timestamp;
+    frame.id = id;
+    frame.flags = flags;
+    frame.len = dlc > 8 ? 8 : dlc;
+    return true;
+}
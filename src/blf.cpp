@@ -0,0 +1,204 @@
+#include <stdlib.h>
+#include "blf.h"
+
+#ifndef ARDUINO
+#include <zlib.h>
+#define ps_malloc malloc
+#endif
+
+#define BLF_OBJECT_HEADER_SIZE 16
+#define BLF_CONTAINER_HEADER_SIZE 32
+#define BLF_COMPRESSION_NONE 0
+#define BLF_COMPRESSION_ZLIB 2
+#define BLF_TIME_TEN_MICS 1
+#define BLF_CAN_MSG_RTR 0x80
+#define BLF_CAN_ID_EXT 0x80000000UL
+
+// Step over the padding in front of the next object, which writers do not
+// agree on, and make its header available
+static bool findObject(BlockBuffer* b)
+{
+    size_t avail = b->ensure(BLF_OBJECT_HEADER_SIZE + 7);
+    for (size_t i = 0; i < 8 && i + BLF_OBJECT_HEADER_SIZE <= avail; i++)
+    {
+        if (memcmp(b->pos + i, BLF_OBJECT_MAGIC, 4) == 0)
+        {
+            b->pos += i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ==================== Containers ====================
+
+BlfContainerSource::~BlfContainerSource()
+{
+#ifdef ARDUINO
+    free(inflator);
+#endif
+    free(in);
+    free(out);
+}
+
+bool BlfContainerSource::begin()
+{
+    in = (uint8_t*)ps_malloc(BLF_MAX_CONTAINER);
+    out = (uint8_t*)ps_malloc(BLF_MAX_CONTAINER);
+#ifdef ARDUINO
+    inflator = (tinfl_decompressor*)ps_malloc(sizeof(tinfl_decompressor));
+    if (!inflator) return false;
+#endif
+    return in && out;
+}
+
+bool BlfContainerSource::nextContainer()
+{
+    while (findObject(outer))
+    {
+        uint32_t objectSize;
+        uint32_t type;
+        memcpy(&objectSize, outer->pos + 8, 4);
+        memcpy(&type, outer->pos + 12, 4);
+        if (objectSize < BLF_OBJECT_HEADER_SIZE) return false;
+
+        if (type != BLF_LOG_CONTAINER)
+        {
+            // Object outside a container, as written by older tools
+            if (objectSize > BLF_MAX_CONTAINER)
+            {
+                if (!outer->skip(objectSize)) return false;
+                continue;
+            }
+            if (outer->take(out, objectSize) != objectSize) return false;
+            len = objectSize;
+            pos = 0;
+            return true;
+        }
+
+        if (outer->ensure(BLF_CONTAINER_HEADER_SIZE) < BLF_CONTAINER_HEADER_SIZE) return false;
+        uint16_t compression;
+        uint32_t size;
+        memcpy(&compression, outer->pos + 16, 2);
+        memcpy(&size, outer->pos + 24, 4);
+        outer->pos += BLF_CONTAINER_HEADER_SIZE;
+        size_t payload = objectSize - BLF_CONTAINER_HEADER_SIZE;
+        if (objectSize < BLF_CONTAINER_HEADER_SIZE || payload > BLF_MAX_CONTAINER || size > BLF_MAX_CONTAINER)
+        {
+            READER_EVENT(READER_BLF_TOO_LARGE, size);
+            return false;
+        }
+
+        if (compression == BLF_COMPRESSION_NONE)
+        {
+            if (outer->take(out, payload) != payload) return false;
+            len = payload;
+        }
+        else if (compression == BLF_COMPRESSION_ZLIB)
+        {
+            if (outer->take(in, payload) != payload) return false;
+#ifdef ARDUINO
+            size_t inBytes = payload;
+            size_t outBytes = BLF_MAX_CONTAINER;
+            tinfl_init(inflator);
+            tinfl_status status = tinfl_decompress(inflator, in, &inBytes, out, out, &outBytes,
+                                                   TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+            if (status != TINFL_STATUS_DONE)
+#else
+            uLongf outBytes = BLF_MAX_CONTAINER;
+            int status = uncompress(out, &outBytes, in, payload);
+            if (status != Z_OK)
+#endif
+            {
+                READER_EVENT(READER_BLF_INFLATE, status);
+                return false;
+            }
+            len = outBytes;
+        }
+        else
+        {
+            outer->skip(payload);
+            continue;
+        }
+        pos = 0;
+        if (len > 0) return true;
+    }
+    return false;
+}
+
+size_t BlfContainerSource::read(uint8_t* buf, size_t n)
+{
+    if (pos == len && !nextContainer()) return 0;
+    size_t chunk = std::min(n, len - pos);
+    memcpy(buf, out + pos, chunk);
+    pos += chunk;
+    return chunk;
+}
+
+// ==================== Objects ====================
+
+BlfReader::~BlfReader()
+{
+    delete objects;
+    delete containers;
+}
+
+bool BlfReader::begin()
+{
+    uint32_t headerSize;
+    if (buffer->ensure(8) < 8) return false;
+    memcpy(&headerSize, buffer->pos + 4, 4);
+    if (!buffer->skip(headerSize)) return false;
+
+    containers = new BlfContainerSource(buffer);
+    if (!containers->begin()) return false;
+    objects = new BlockBuffer(containers);
+    return true;
+}
+
+bool BlfReader::next(CanFrame& frame)
+{
+    while (findObject(objects))
+    {
+        uint16_t headerSize;
+        uint32_t objectSize;
+        uint32_t type;
+        memcpy(&headerSize, objects->pos + 4, 2);
+        memcpy(&objectSize, objects->pos + 8, 4);
+        memcpy(&type, objects->pos + 12, 4);
+        if (objectSize < BLF_OBJECT_HEADER_SIZE) return false;
+
+        if ((type == BLF_CAN_MESSAGE || type == BLF_CAN_MESSAGE2) && headerSize >= 32 &&
+            objectSize >= headerSize + 16u && objectSize <= REPLAY_MAX_LINE &&
+            objects->ensure(objectSize) >= objectSize)
+        {
+            const char* p = objects->pos;
+            uint32_t objectFlags;
+            uint64_t timestamp;
+            memcpy(&objectFlags, p + 16, 4);
+            memcpy(&timestamp, p + 24, 8);
+
+            const char* body = p + headerSize;
+            uint8_t msgFlags = body[2];
+            uint8_t dlc = body[3];
+            uint32_t id;
+            memcpy(&id, body + 4, 4);
+
+            // Ten microsecond or nanosecond units
+            if (objectFlags & BLF_TIME_TEN_MICS)
+                frame.timestampUs = timestamp * 10;
+            else
+                frame.timestampUs = timestamp / 1000;
+            frame.id = id & 0x1FFFFFFFUL;
+            frame.flags = (id & BLF_CAN_ID_EXT) ? CAN_FRAME_EXT : 0;
+            if (msgFlags & BLF_CAN_MSG_RTR) frame.flags |= CAN_FRAME_RTR;
+            frame.len = dlc > 8 ? 8 : dlc;
+            memcpy(frame.data, body + 8, 8);
+            objects->pos += objectSize;
+            return true;
+        }
+
+        if (!objects->skip(objectSize)) return false;
+    }
+    return false;
+}
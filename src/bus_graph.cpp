@@ -0,0 +1,85 @@
+#include <M5Unified.h>
+#include "bus_graph.h"
+#include "config.h"
+#include "metrics.h"
+#include "top_talkers.h"
+#include "status_display.h"
+
+static M5Canvas columnSprite; // newest sample
+static M5Canvas barSprite;    // erase bar ahead of it
+static int16_t graphY = 0;
+static GraphSample previous = {};
+static uint16_t column = 0; // screen column of the next sample
+
+static void createColumn(M5Canvas& sprite, uint16_t color)
+{
+    // DMA reads the sprite, so it has to stay in internal RAM
+    sprite.setPsram(false);
+    sprite.setColorDepth(16);
+    sprite.createSprite(1, GRAPH_HEIGHT);
+    sprite.fillSprite(color);
+}
+
+void initBusGraph(int16_t y)
+{
+    graphY = y;
+    createColumn(columnSprite, BLACK);
+    createColumn(barSprite, DARKGREY);
+    M5.Lcd.fillRect(0, graphY, GRAPH_WIDTH, GRAPH_HEIGHT, BLACK);
+}
+
+// Aggregate the counters since the previous sample. Every counter only
+// grows and has a single writer, so differences need no lock.
+static void takeSample(GraphSample& sample)
+{
+    static uint32_t lastBits = 0;
+    static uint32_t lastErrorSum = 0;
+    static uint32_t lastErrorCount = 0;
+
+    uint32_t bits = topTalkers.totalBits();
+    uint32_t load = (uint64_t)(bits - lastBits) * 100 * 1000 / ((uint64_t)CAN_BITRATE * GRAPH_SAMPLE_MS);
+    lastBits = bits;
+    sample.loadPercent = load > 100 ? 100 : load;
+
+    uint32_t errorSum = metricCount(METRIC_TIMING_ERROR_SUM_US);
+    uint32_t errorCount = metricCount(METRIC_TIMING_ERROR_COUNT);
+    uint32_t frames = errorCount - lastErrorCount;
+    uint32_t error = frames ? (errorSum - lastErrorSum) / frames : 0;
+    lastErrorSum = errorSum;
+    lastErrorCount = errorCount;
+    sample.timingErrorUs = error > 0xFFFF ? 0xFFFF : error;
+}
+
+static int16_t scaleY(uint32_t value, uint32_t full)
+{
+    if (value > full) value = full;
+    return GRAPH_HEIGHT - 1 - (int16_t)(value * (GRAPH_HEIGHT - 1) / full);
+}
+
+// The step from the previous sample, as a vertical run in one column
+static void drawStep(uint32_t from, uint32_t to, uint32_t full, uint16_t color)
+{
+    int16_t y0 = scaleY(from, full);
+    int16_t y1 = scaleY(to, full);
+    columnSprite.drawFastVLine(0, min(y0, y1), abs(y1 - y0) + 1, color);
+}
+
+void updateBusGraph()
+{
+    const int16_t x = column;
+    GraphSample sample;
+    takeSample(sample);
+    column = (x + 1) % GRAPH_WIDTH;
+
+    columnSprite.fillSprite(BLACK);
+    drawStep(previous.loadPercent, sample.loadPercent, 100, GREEN);
+    if (sample.timingErrorUs || previous.timingErrorUs)
+    {
+        drawStep(previous.timingErrorUs, sample.timingErrorUs, GRAPH_ERROR_FULL_US, RED);
+    }
+
+    previous = sample;
+
+    pushSpriteDMA(columnSprite, x, graphY);
+    pushSpriteDMA(barSprite, column, graphY);
+}
@@ -0,0 +1,174 @@
+#include <SD.h>
+#include <algorithm>
+#include "can_id_filter.h"
+#include "telemetry.h"
+
+CanIdFilter idFilter;
+
+#define HASH_EMPTY 0xFFFFFFFFUL
+
+static int compareIds(const void* a, const void* b)
+{
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+// Sort and drop duplicates, returns the new count
+static size_t sortUnique(uint32_t* ids, size_t n)
+{
+    qsort(ids, n, sizeof(uint32_t), compareIds);
+    size_t out = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (out == 0 || ids[out - 1] != ids[i]) ids[out++] = ids[i];
+    }
+    return out;
+}
+
+bool CanIdFilter::load(const char* path)
+{
+    File f = SD.open(path, FILE_READ);
+    if (!f) return false;
+
+    stdCount = 0;
+    extCount = 0;
+    memset(stdBitmap, 0, sizeof(stdBitmap));
+
+    char line[32];
+    while (f.available())
+    {
+        size_t n = f.readBytesUntil('\n', line, sizeof(line) - 1);
+        line[n] = 0;
+
+        char* p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == 0 || *p == '#' || *p == '\r') continue;
+
+        char* end;
+        uint32_t id = strtoul(p, &end, 16);
+        if (end == p) continue;
+
+        if (id > 0x7FF || end - p > 3)
+        {
+            if (extCount < CAN_ID_MAX) extIds[extCount++] = id & 0x1FFFFFFFUL;
+        }
+        else if (stdCount < CAN_ID_MAX)
+        {
+            stdIds[stdCount++] = id;
+        }
+    }
+    f.close();
+
+    stdCount = sortUnique(stdIds, stdCount);
+    extCount = sortUnique(extIds, extCount);
+    for (size_t i = 0; i < stdCount; i++)
+    {
+        stdBitmap[stdIds[i] >> 5] |= 1UL << (stdIds[i] & 31);
+    }
+
+    if (!buildHash())
+    {
+        telemetryEvent(EVENT_ID_FILTER, ID_FILTER_NO_HASH, 0);
+        extCount = 0;
+    }
+
+    active = stdCount + extCount > 0;
+    telemetryEvent(EVENT_ID_FILTER, ID_FILTER_LOADED, stdCount | (uint32_t)extCount << 16);
+    return active;
+}
+
+static uint32_t nextPowerOfTwo(uint32_t n)
+{
+    uint32_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+bool CanIdFilter::buildHash()
+{
+    free(hashTable);
+    free(displacement);
+    hashTable = nullptr;
+    displacement = nullptr;
+    if (!extCount) return true;
+
+    uint32_t buckets = nextPowerOfTwo(extCount / 2 + 1);
+    bucketMask = buckets - 1;
+    displacement = (uint16_t*)calloc(buckets, sizeof(uint16_t));
+
+    // Bucket of every ID, and the buckets ordered largest first
+    uint32_t* bucketOf = (uint32_t*)malloc(extCount * sizeof(uint32_t));
+    uint16_t* order = (uint16_t*)malloc(buckets * sizeof(uint16_t));
+    uint16_t* size = (uint16_t*)calloc(buckets, sizeof(uint16_t));
+    if (!displacement || !bucketOf || !order || !size)
+    {
+        free(bucketOf);
+        free(order);
+        free(size);
+        return false;
+    }
+    for (size_t i = 0; i < extCount; i++)
+    {
+        bucketOf[i] = hashId(extIds[i], 0) & bucketMask;
+        size[bucketOf[i]]++;
+    }
+    for (uint32_t b = 0; b < buckets; b++) order[b] = b;
+    std::sort(order, order + buckets, [size](uint16_t a, uint16_t b) { return size[a] > size[b]; });
+
+    // A table at most half full makes free slots easy to find, it grows
+    // only if some bucket finds no displacement at all
+    bool placed = false;
+    for (uint32_t slots = nextPowerOfTwo(extCount * 2); !placed && slots <= extCount * 16; slots <<= 1)
+    {
+        free(hashTable);
+        hashTable = (uint32_t*)malloc(slots * sizeof(uint32_t));
+        if (!hashTable) break;
+        memset(hashTable, 0xFF, slots * sizeof(uint32_t));
+        slotMask = slots - 1;
+
+        placed = true;
+        for (uint32_t o = 0; o < buckets && placed && size[order[o]]; o++)
+        {
+            uint32_t b = order[o];
+            placed = false;
+            for (uint32_t d = 1; d < 0x10000 && !placed; d++)
+            {
+                // Try every ID of the bucket, undo on collision
+                size_t done = 0;
+                bool ok = true;
+                for (size_t i = 0; i < extCount && ok; i++)
+                {
+                    if (bucketOf[i] != b) continue;
+                    uint32_t slot = hashId(extIds[i], d) & slotMask;
+                    if (hashTable[slot] != HASH_EMPTY)
+                    {
+                        ok = false;
+                        break;
+                    }
+                    hashTable[slot] = extIds[i];
+                    done++;
+                }
+                if (ok)
+                {
+                    displacement[b] = d;
+                    placed = true;
+                }
+                else
+                {
+                    for (size_t i = 0; i < extCount && done; i++)
+                    {
+                        if (bucketOf[i] != b) continue;
+                        hashTable[hashId(extIds[i], d) & slotMask] = HASH_EMPTY;
+                        done--;
+                    }
+                }
+            }
+        }
+    }
+
+    free(bucketOf);
+    free(order);
+    free(size);
+    return placed;
+}
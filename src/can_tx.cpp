@@ -0,0 +1,78 @@
+#include <SPI.h>
+#include <esp_timer.h>
+#include "can_tx.h"
+#include "can_bus.h"
+#include "stage_profiler.h"
+#include "trace_buffer.h"
+
+#define MCP_LOAD_TX0 0x40   // LOAD TX BUFFER, starting at TXB0SIDH
+#define MCP_RTS_TX0 0x81    // request to send TXB0
+#define MCP_READ_STATUS 0xA0
+#define MCP_STATUS_TX0REQ 0x04
+#define MCP_DLC_RTR 0x40
+#define MCP_SIDL_EXIDE 0x08
+
+static const SPISettings mcpSpi(10000000, MSBFIRST, SPI_MODE0);
+
+static uint8_t readStatus()
+{
+    SPI.beginTransaction(mcpSpi);
+    digitalWrite(CAN0_CS, LOW);
+    SPI.transfer(MCP_READ_STATUS);
+    uint8_t status = SPI.transfer(0);
+    digitalWrite(CAN0_CS, HIGH);
+    SPI.endTransaction();
+    return status;
+}
+
+uint8_t transmitFrame(const CanFrame& frame)
+{
+    STAGE_START(doneStart);
+    int64_t start = esp_timer_get_time();
+    while (readStatus() & MCP_STATUS_TX0REQ)
+    {
+        if (esp_timer_get_time() - start > CAN_TX_TIMEOUT_US) return CAN_GETTXBFTIMEOUT;
+    }
+    STAGE_END(STAGE_TX_DONE, doneStart);
+    TRACE(TRACE_TX_FREE, 0);
+
+    // TXB0SIDH, SIDL, EID8, EID0, DLC, D0..D7
+    uint8_t regs[14];
+    uint32_t id = frame.id;
+    if (frame.flags & CAN_FRAME_EXT)
+    {
+        regs[0] = id >> 21;
+        regs[1] = ((id >> 13) & 0xE0) | MCP_SIDL_EXIDE | ((id >> 16) & 0x03);
+        regs[2] = id >> 8;
+        regs[3] = id;
+    }
+    else
+    {
+        regs[0] = id >> 3;
+        regs[1] = (id & 0x07) << 5;
+        regs[2] = 0;
+        regs[3] = 0;
+    }
+    uint8_t len = frame.len > 8 ? 8 : frame.len;
+    regs[4] = len | ((frame.flags & CAN_FRAME_RTR) ? MCP_DLC_RTR : 0);
+    uint8_t n = 5;
+    if (!(frame.flags & CAN_FRAME_RTR))
+    {
+        memcpy(regs + 5, frame.data, len);
+        n += len;
+    }
+
+    STAGE_START(loadStart);
+    SPI.beginTransaction(mcpSpi);
+    digitalWrite(CAN0_CS, LOW);
+    SPI.transfer(MCP_LOAD_TX0);
+    SPI.transferBytes(regs, NULL, n);
+    digitalWrite(CAN0_CS, HIGH);
+    digitalWrite(CAN0_CS, LOW);
+    SPI.transfer(MCP_RTS_TX0);
+    digitalWrite(CAN0_CS, HIGH);
+    SPI.endTransaction();
+    STAGE_END(STAGE_SPI_LOAD, loadStart);
+    TRACE(TRACE_TX_START, (frame.flags & CAN_FRAME_EXT) ? frame.id | 0x80000000UL : frame.id);
+    return CAN_OK;
+}
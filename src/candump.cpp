@@ -0,0 +1,157 @@
+#include "candump.h"
+
+static const char hexDigits[] = "0123456789ABCDEF";
+
+const int8_t hexValue[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+};
+
+static char* putDecimal(char* p, uint32_t value, int width)
+{
+    char tmp[10];
+    int n = 0;
+    do
+    {
+        tmp[n++] = '0' + value % 10;
+        value /= 10;
+    } while (value);
+    while (n < width) tmp[n++] = '0';
+    while (n) *p++ = tmp[--n];
+    return p;
+}
+
+static char* putHex(char* p, uint32_t value, int digits)
+{
+    for (int shift = (digits - 1) * 4; shift >= 0; shift -= 4)
+    {
+        *p++ = hexDigits[(value >> shift) & 0xF];
+    }
+    return p;
+}
+
+size_t formatCandump(const CanFrame& frame, char* out)
+{
+    char* p = out;
+    uint64_t us = frame.timestampUs < 0 ? 0 : (uint64_t)frame.timestampUs;
+
+    *p++ = '(';
+    p = putDecimal(p, (uint32_t)(us / 1000000), 1);
+    *p++ = '.';
+    p = putDecimal(p, (uint32_t)(us % 1000000), 6);
+    memcpy(p, ") can0 ", 7);
+    p += 7;
+
+    if (frame.flags & CAN_FRAME_ERR)
+        p = putHex(p, frame.id | 0x20000000UL, 8);
+    else if (frame.flags & CAN_FRAME_EXT)
+        p = putHex(p, frame.id, 8);
+    else
+        p = putHex(p, frame.id, 3);
+    *p++ = '#';
+
+    if (frame.flags & CAN_FRAME_RTR)
+    {
+        *p++ = 'R';
+    }
+    else
+    {
+        uint8_t len = frame.len > 8 ? 8 : frame.len;
+        for (uint8_t i = 0; i < len; i++)
+        {
+            *p++ = hexDigits[frame.data[i] >> 4];
+            *p++ = hexDigits[frame.data[i] & 0xF];
+        }
+    }
+    *p++ = '\n';
+    return p - out;
+}
+
+bool parseCandump(const char* p, const char* end, CanFrame& frame)
+{
+    while (p < end && *p == ' ') p++;
+    if (p == end || *p++ != '(') return false;
+
+    // Seconds and up to six fraction digits, kept in integer microseconds
+    int64_t seconds = 0;
+    while (p < end && *p >= '0' && *p <= '9') seconds = seconds * 10 + (*p++ - '0');
+    int32_t micros = 0;
+    int digits = 0;
+    if (p < end && *p == '.')
+    {
+        p++;
+        while (p < end && *p >= '0' && *p <= '9')
+        {
+            if (digits++ < 6) micros = micros * 10 + (*p - '0');
+            p++;
+        }
+    }
+    while (digits++ < 6) micros *= 10;
+    if (p == end || *p++ != ')') return false;
+    frame.timestampUs = seconds * 1000000 + micros;
+
+    // Interface name, whatever it is
+    while (p < end && *p == ' ') p++;
+    const char* ifName = p;
+    while (p < end && *p != ' ') p++;
+    if (p == ifName) return false;
+    while (p < end && *p == ' ') p++;
+
+    uint32_t id = 0;
+    const char* idStart = p;
+    while (p < end && hexValue[(uint8_t)*p] >= 0) id = (id << 4) | hexValue[(uint8_t)*p++];
+    size_t idDigits = p - idStart;
+    if (idDigits == 0 || p == end || *p++ != '#') return false;
+    if (p < end && *p == '#') return false; // CAN FD
+
+    if (idDigits <= 3)
+    {
+        frame.id = id;
+        frame.flags = 0;
+    }
+    else if (id & 0x20000000UL)
+    {
+        frame.id = id & 0x1FFFFFFFUL;
+        frame.flags = CAN_FRAME_ERR;
+    }
+    else
+    {
+        frame.id = id;
+        frame.flags = CAN_FRAME_EXT;
+    }
+
+    // Remote frame, optionally with its DLC
+    if (p < end && (*p == 'R' || *p == 'r'))
+    {
+        p++;
+        frame.flags |= CAN_FRAME_RTR;
+        frame.len = (p < end && *p >= '0' && *p <= '8') ? *p - '0' : 0;
+        return true;
+    }
+
+    uint8_t len = 0;
+    while (end - p >= 2 && len < 8)
+    {
+        int8_t high = hexValue[(uint8_t)p[0]];
+        int8_t low = hexValue[(uint8_t)p[1]];
+        if (high < 0 || low < 0) break;
+        frame.data[len++] = (high << 4) | low;
+        p += 2;
+    }
+    frame.len = len;
+    return true;
+}
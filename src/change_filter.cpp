@@ -0,0 +1,89 @@
+#include <esp_heap_caps.h>
+#include "change_filter.h"
+#include "metrics.h"
+#include "telemetry.h"
+
+static constexpr uint32_t log2Of(uint32_t n)
+{
+    return n > 1 ? 1 + log2Of(n / 2) : 0;
+}
+
+static const uint32_t tableMask = CHANGE_TABLE_SIZE - 1;
+static const uint32_t tableShift = 32 - log2Of(CHANGE_TABLE_SIZE); // top bits of the hash
+static_assert(CHANGE_TABLE_SIZE >= 2 && (CHANGE_TABLE_SIZE & tableMask) == 0, "CHANGE_TABLE_SIZE must be a power of two");
+
+bool ChangeFilter::begin()
+{
+    // Looked up for every frame, kept out of PSRAM, which a plain new of
+    // this size would land in
+    table = (Entry*)heap_caps_calloc(CHANGE_TABLE_SIZE, sizeof(Entry), MALLOC_CAP_INTERNAL);
+    if (!table)
+    {
+        telemetryEvent(EVENT_UNAVAILABLE, FEATURE_CHANGE_FILTER, 0);
+        return false;
+    }
+    return sink->begin();
+}
+
+void ChangeFilter::end()
+{
+    sink->end();
+    free(table);
+    table = nullptr;
+}
+
+// Linear probing, returns the entry for key, a free slot claimed for it, or
+// NULL when the table is full
+ChangeFilter::Entry* ChangeFilter::lookup(uint32_t key)
+{
+    uint32_t h = key * 0x9E3779B1UL;
+    uint32_t slot = h >> tableShift;
+    for (uint32_t probe = 0; probe < CHANGE_TABLE_SIZE; probe++)
+    {
+        Entry& e = table[(slot + probe) & tableMask];
+        if (e.key == key) return &e;
+        if (e.key == 0)
+        {
+            e.key = key;
+            e.len = 0xFF; // never matches, the first frame is always stored
+            return &e;
+        }
+    }
+    return NULL;
+}
+
+void ChangeFilter::write(const CanFrame& frame)
+{
+    if (frame.flags & CAN_FRAME_ERR)
+    {
+        sink->write(frame);
+        return;
+    }
+
+    // Bit 31 keeps ID 0 apart from a free slot, the other flags keep
+    // standard, extended and remote frames apart
+    uint32_t key = 0x80000000UL | ((uint32_t)(frame.flags & (CAN_FRAME_EXT | CAN_FRAME_RTR)) << 29) | frame.id;
+    Entry* e = lookup(key);
+    if (!e)
+    {
+        sink->write(frame);
+        return;
+    }
+
+    uint32_t nowMs = (uint32_t)(frame.timestampUs / 1000);
+    uint16_t keyframe = (uint16_t)(nowMs / CHANGE_KEYFRAME_MS);
+
+    bool changed = e->len != frame.len || memcmp(e->data, frame.data, frame.len) != 0;
+    bool stale = CHANGE_MAX_INTERVAL_MS && nowMs - e->lastMs >= CHANGE_MAX_INTERVAL_MS;
+    if (!changed && !stale && e->keyframe == keyframe)
+    {
+        metricAdd(METRIC_UNCHANGED);
+        return;
+    }
+
+    e->len = frame.len;
+    memcpy(e->data, frame.data, frame.len);
+    e->lastMs = nowMs;
+    e->keyframe = keyframe;
+    sink->write(frame);
+}
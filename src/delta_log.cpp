@@ -0,0 +1,143 @@
+#include "delta_log.h"
+
+#define SLOT_COUNT (DELTA_MAX_IDS * 2)
+
+static_assert((DELTA_MAX_IDS & (DELTA_MAX_IDS - 1)) == 0, "DELTA_MAX_IDS must be a power of two");
+
+static inline uint32_t entryKey(const CanFrame& frame)
+{
+    return frame.id | (uint32_t)frame.flags << 29;
+}
+
+static inline uint8_t* putVarint(uint8_t* p, uint64_t v)
+{
+    while (v >= 0x80)
+    {
+        *p++ = (uint8_t)v | 0x80;
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+    return p;
+}
+
+// ==================== Delta Writer ====================
+
+bool DeltaWriter::begin()
+{
+    entries = (DeltaEntry*)malloc(DELTA_MAX_IDS * sizeof(DeltaEntry));
+    slots = (uint16_t*)calloc(SLOT_COUNT, sizeof(uint16_t));
+    if (!entries || !slots) return false;
+
+    file = openNextLogFile("can_", ".cdl");
+    if (!file) return false;
+
+    uint8_t header[DELTA_HEADER_SIZE] = {'C', 'D', 'L', '1', 1, 0, DELTA_MAX_IDS & 0xFF, DELTA_MAX_IDS >> 8};
+    memcpy(buffer, header, sizeof(header));
+    used = sizeof(header);
+    count = 0;
+    lastTimestamp = 0;
+    return true;
+}
+
+void DeltaWriter::write(const CanFrame& frame)
+{
+    uint8_t record[DELTA_MAX_RECORD];
+    uint8_t* p = record;
+
+    int64_t delta = frame.timestampUs - lastTimestamp;
+    p = putVarint(p, delta > 0 ? delta : 0);
+    if (delta > 0) lastTimestamp = frame.timestampUs;
+
+    // Find the dictionary entry, defining it on first use
+    uint32_t key = entryKey(frame);
+    uint32_t slot = (key * 0x9E3779B1U) >> 20;
+    uint16_t index = DELTA_MAX_IDS;
+    bool newId = false;
+    while (true)
+    {
+        slot &= SLOT_COUNT - 1;
+        if (slots[slot] == 0)
+        {
+            if (count < DELTA_MAX_IDS)
+            {
+                index = count++;
+                slots[slot] = index + 1;
+                entries[index].key = key;
+                entries[index].len = 0;
+                memset(entries[index].data, 0, 8);
+            }
+            newId = true;
+            break;
+        }
+        if (entries[slots[slot] - 1].key == key)
+        {
+            index = slots[slot] - 1;
+            break;
+        }
+        slot++;
+    }
+
+    static DeltaEntry literal;
+    DeltaEntry& e = index < DELTA_MAX_IDS ? entries[index] : literal;
+    if (index == DELTA_MAX_IDS)
+    {
+        literal.len = 0;
+        memset(literal.data, 0, 8);
+    }
+
+    bool newLen = e.len != frame.len;
+    p = putVarint(p, (uint32_t)index << 2 | (newId ? DELTA_KEY_NEW_ID : 0) | (newLen ? DELTA_KEY_NEW_LEN : 0));
+    if (newId) p = putVarint(p, key);
+    if (newLen)
+    {
+        *p++ = frame.len;
+        // Bytes beyond the old length count as zero
+        for (uint8_t i = e.len; i < 8; i++) e.data[i] = 0;
+        e.len = frame.len;
+    }
+
+    uint8_t* mask = p++;
+    *mask = 0;
+    for (uint8_t i = 0; i < frame.len; i++)
+    {
+        uint8_t x = frame.data[i] ^ e.data[i];
+        if (x)
+        {
+            *mask |= 1 << i;
+            *p++ = x;
+            e.data[i] = frame.data[i];
+        }
+    }
+
+    // Fill whole sectors, the record may straddle two
+    size_t n = p - record;
+    size_t room = BUFFER_SIZE - used;
+    if (n >= room)
+    {
+        memcpy(buffer + used, record, room);
+        file.write((const uint8_t*)buffer, BUFFER_SIZE);
+        memcpy(buffer, record + room, n - room);
+        used = n - room;
+    }
+    else
+    {
+        memcpy(buffer + used, record, n);
+        used += n;
+    }
+}
+
+void DeltaWriter::flush()
+{
+    syncSectorTail(file, buffer, used);
+}
+
+void DeltaWriter::end()
+{
+    if (used > 0) file.write((const uint8_t*)buffer, used);
+    used = 0;
+    file.close();
+    free(entries);
+    free(slots);
+    entries = nullptr;
+    slots = nullptr;
+}
@@ -0,0 +1,76 @@
+#include <stdlib.h>
+#include "delta_log.h"
+
+static inline bool getVarint(const uint8_t*& p, const uint8_t* end, uint64_t& v)
+{
+    v = 0;
+    for (int shift = 0; p < end && shift < 64; shift += 7)
+    {
+        uint8_t b = *p++;
+        v |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) return true;
+    }
+    return false;
+}
+
+bool DeltaReader::begin()
+{
+    if (buffer->ensure(DELTA_HEADER_SIZE) < DELTA_HEADER_SIZE) return false;
+    const uint8_t* h = (const uint8_t*)buffer->pos;
+    if (memcmp(h, DELTA_MAGIC, 4) != 0 || h[4] != 1) return false;
+    capacity = h[6] | h[7] << 8;
+    buffer->pos += DELTA_HEADER_SIZE;
+
+    entries = (DeltaEntry*)calloc(capacity, sizeof(DeltaEntry));
+    return entries != nullptr;
+}
+
+bool DeltaReader::next(CanFrame& frame)
+{
+    size_t avail = buffer->ensure(DELTA_MAX_RECORD);
+    if (avail == 0) return false;
+
+    const uint8_t* p = (const uint8_t*)buffer->pos;
+    const uint8_t* end = p + avail;
+    uint64_t delta;
+    uint64_t key;
+    if (!getVarint(p, end, delta) || !getVarint(p, end, key)) return false;
+
+    uint32_t index = key >> 2;
+    if (index > capacity) return false;
+
+    DeltaEntry literal = {};
+    DeltaEntry& e = index < capacity ? entries[index] : literal;
+    if (key & DELTA_KEY_NEW_ID)
+    {
+        uint64_t id;
+        if (!getVarint(p, end, id)) return false;
+        e.key = (uint32_t)id;
+        e.len = 0;
+        memset(e.data, 0, 8);
+    }
+    if (key & DELTA_KEY_NEW_LEN)
+    {
+        if (p >= end || *p > 8) return false;
+        for (uint8_t i = e.len; i < 8; i++) e.data[i] = 0;
+        e.len = *p++;
+    }
+
+    if (p >= end) return false;
+    uint8_t mask = *p++;
+    for (uint8_t i = 0; i < e.len; i++)
+    {
+        if (!(mask & (1 << i))) continue;
+        if (p >= end) return false;
+        e.data[i] ^= *p++;
+    }
+    buffer->pos = (char*)p;
+
+    timestamp += delta;
+    frame.timestampUs = timestamp;
+    frame.id = e.key & 0x1FFFFFFFUL;
+    frame.flags = e.key >> 29;
+    frame.len = e.len;
+    memcpy(frame.data, e.data, 8);
+    return true;
+}
@@ -0,0 +1,164 @@
+#include "flight_recorder.h"
+#include "candump.h"
+#include "telemetry.h"
+
+static const size_t payloadSize = FLIGHT_BLOCK_SIZE - sizeof(FlightBlockHeader);
+
+static uint32_t headerCheck(const FlightBlockHeader& h)
+{
+    return h.magic ^ h.epoch ^ h.sequence ^ ((uint32_t)h.used << 16 | h.frames);
+}
+
+bool FlightRecorder::begin()
+{
+    blockCount = (uint32_t)((uint64_t)FLIGHT_FILE_MB * 1024 * 1024 / FLIGHT_BLOCK_SIZE);
+    block = (uint8_t*)malloc(FLIGHT_BLOCK_SIZE);
+    if (!block) return false;
+
+    used = 0;
+    frames = 0;
+    if (openRing())
+    {
+        telemetryEvent(EVENT_FLIGHT, FLIGHT_RESUMED, index);
+        return true;
+    }
+    return create();
+}
+
+// An existing ring of this size and format, its epoch taken from block 0
+bool FlightRecorder::openRing()
+{
+    // "r+" keeps the contents, FILE_WRITE would truncate the ring
+    file = SD.open(FLIGHT_FILE_PATH, "r+");
+    if (!file) return false;
+
+    FlightBlockHeader h;
+    if (file.size() == (size_t)blockCount * FLIGHT_BLOCK_SIZE &&
+        file.read((uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+        h.magic == FLIGHT_MAGIC && h.check == headerCheck(h) && h.sequence != 0)
+    {
+        epoch = h.epoch;
+        locateHead();
+        return true;
+    }
+    file.close();
+    return false;
+}
+
+// Extends a new file to full size by writing its last block, which takes
+// the file system a FAT update rather than FLIGHT_FILE_MB of writes. Block
+// 0 is then written empty to record the epoch; the first frames fill it in
+// place.
+bool FlightRecorder::create()
+{
+    File f = SD.open(FLIGHT_FILE_PATH, FILE_WRITE);
+    if (!f) return false;
+    memset(block, 0, FLIGHT_BLOCK_SIZE);
+    bool sized = f.seek((size_t)(blockCount - 1) * FLIGHT_BLOCK_SIZE) &&
+                 f.write(block, FLIGHT_BLOCK_SIZE) == FLIGHT_BLOCK_SIZE;
+    f.close();
+    if (!sized) return false;
+
+    file = SD.open(FLIGHT_FILE_PATH, "r+");
+    if (!file) return false;
+    epoch = esp_random();
+    index = 0;
+    sequence = 1;
+    writeBlock();
+    file.flush();
+    telemetryEvent(EVENT_FLIGHT, FLIGHT_CREATED, FLIGHT_FILE_MB);
+    return true;
+}
+
+uint32_t FlightRecorder::readSequence(uint32_t n)
+{
+    FlightBlockHeader h;
+    file.seek((size_t)n * FLIGHT_BLOCK_SIZE);
+    if (file.read((uint8_t*)&h, sizeof(h)) != sizeof(h)) return 0;
+    if (h.magic != FLIGHT_MAGIC || h.epoch != epoch || h.check != headerCheck(h)) return 0;
+    return h.sequence;
+}
+
+// Sequence numbers rise from block 0 up to the newest block, then drop to
+// older (or never written) blocks. Find the last block whose sequence is
+// not below that of block 0, in log2(blockCount) header reads.
+void FlightRecorder::locateHead()
+{
+    uint32_t first = readSequence(0);
+    if (first == 0)
+    {
+        index = 0;
+        sequence = 1;
+        return;
+    }
+
+    uint32_t lo = 0;
+    uint32_t hi = blockCount - 1;
+    while (lo < hi)
+    {
+        uint32_t mid = lo + (hi - lo + 1) / 2;
+        if (readSequence(mid) >= first)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    sequence = readSequence(lo) + 1;
+    index = (lo + 1) % blockCount;
+}
+
+void FlightRecorder::writeBlock()
+{
+    FlightBlockHeader h;
+    h.magic = FLIGHT_MAGIC;
+    h.epoch = epoch;
+    h.sequence = sequence;
+    h.used = used;
+    h.frames = frames;
+    h.check = headerCheck(h);
+    memcpy(block, &h, sizeof(h));
+    memset(block + sizeof(h) + used, 0, payloadSize - used);
+
+    file.seek((size_t)index * FLIGHT_BLOCK_SIZE);
+    file.write(block, FLIGHT_BLOCK_SIZE);
+}
+
+void FlightRecorder::write(const CanFrame& frame)
+{
+    char line[CANDUMP_MAX_LINE];
+    size_t n = formatCandump(frame, line);
+
+    if (used + n > payloadSize)
+    {
+        writeBlock();
+        index = (index + 1) % blockCount;
+        sequence++;
+        used = 0;
+        frames = 0;
+        if (++unsynced >= FLIGHT_SYNC_BLOCKS)
+        {
+            file.flush();
+            unsynced = 0;
+        }
+    }
+
+    memcpy(block + sizeof(FlightBlockHeader) + used, line, n);
+    used += n;
+    frames++;
+}
+
+// A partial block is written in place and rewritten once it fills up, its
+// sequence number does not change.
+void FlightRecorder::flush()
+{
+    if (used > 0) writeBlock();
+    file.flush();
+    unsynced = 0;
+}
+
+void FlightRecorder::end()
+{
+    flush();
+    file.close();
+    free(block);
+    block = nullptr;
+}
@@ -0,0 +1,68 @@
+#include "frame_reader.h"
+#include "candump.h"
+#include "asc.h"
+#include "delta_log.h"
+#include "pcapng.h"
+#include "blf.h"
+#include "mdf4.h"
+
+// ==================== candump ====================
+
+class CandumpReader : public FrameReader
+{
+public:
+    using FrameReader::FrameReader;
+    bool next(CanFrame& frame) override;
+    const char* name() const override { return "candump"; }
+};
+
+bool CandumpReader::next(CanFrame& frame)
+{
+    const char* line;
+    const char* lineEnd;
+    while (buffer->nextLine(line, lineEnd))
+    {
+        if (parseCandump(line, lineEnd, frame)) return true;
+    }
+    return false;
+}
+
+// ==================== Format Detection ====================
+
+FrameReader* openFrameReader(LogSource* source)
+{
+    BlockBuffer* buffer = new BlockBuffer(source);
+    size_t avail = buffer->ensure(16);
+
+    if (avail >= 4 && memcmp(buffer->pos, DELTA_MAGIC, 4) == 0)
+    {
+        DeltaReader* delta = new DeltaReader(buffer);
+        if (delta->begin()) return delta;
+        delete delta;
+        return NULL;
+    }
+
+    uint32_t blockType = 0;
+    if (avail >= 4) memcpy(&blockType, buffer->pos, 4);
+    if (blockType == PCAPNG_SHB) return new PcapngReader(buffer);
+
+    if (avail >= 4 && memcmp(buffer->pos, BLF_FILE_MAGIC, 4) == 0)
+    {
+        BlfReader* blf = new BlfReader(buffer);
+        if (blf->begin()) return blf;
+        delete blf;
+        return NULL;
+    }
+
+    if (avail >= 8 && (memcmp(buffer->pos, "MDF     ", 8) == 0 || memcmp(buffer->pos, "UnFinMF ", 8) == 0))
+    {
+        Mf4Reader* mf4 = new Mf4Reader(buffer);
+        if (mf4->begin()) return mf4;
+        delete mf4;
+        return NULL;
+    }
+
+    if (isAscLog(buffer->pos, avail)) return new AscReader(buffer);
+
+    return new CandumpReader(buffer);
+}
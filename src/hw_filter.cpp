@@ -0,0 +1,295 @@
+#include <algorithm>
+#include "hw_filter.h"
+#include "can_bus.h"
+#include "telemetry.h"
+
+// The plan is made at boot, before the first frame, so the search is bounded:
+// at most PLAN_MAX_CUTS splits of the list are tried, hill climbing only runs
+// for short lists, the candidate bits of a fit are judged on at most
+// PLAN_SAMPLE_VALUES values, and a fit stops once its buffer accepts every ID
+// or costs more than the best split so far.
+#define PLAN_FULL_SPLIT_MAX 128
+#define PLAN_CLIMB_MAX 32
+#define PLAN_MAX_CUTS 17
+#define PLAN_SAMPLE_VALUES 32
+
+static uint32_t scratch[2 * CAN_ID_MAX];
+
+// Distinct values of id & mask, left sorted in scratch
+static size_t countDistinct(const uint32_t* ids, size_t n, uint32_t mask)
+{
+    for (size_t i = 0; i < n; i++) scratch[i] = ids[i] & mask;
+    std::sort(scratch, scratch + n);
+    size_t distinct = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (distinct == 0 || scratch[distinct - 1] != scratch[i]) scratch[distinct++] = scratch[i];
+    }
+    return distinct;
+}
+
+// Clear bit in the sorted distinct values, which stay sorted and distinct.
+// Values without the bit and those with it each remain in order, so the two
+// runs are merged in one pass.
+static size_t clearBit(uint32_t* values, size_t n, uint32_t bit)
+{
+    size_t nLow = 0;
+    size_t nHigh = 0;
+    uint32_t* high = scratch + CAN_ID_MAX;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (values[i] & bit)
+            high[nHigh++] = values[i] & ~bit;
+        else
+            scratch[nLow++] = values[i];
+    }
+    size_t i = 0;
+    size_t j = 0;
+    size_t out = 0;
+    while (i < nLow || j < nHigh)
+    {
+        uint32_t v = j == nHigh || (i < nLow && scratch[i] <= high[j]) ? scratch[i++] : high[j++];
+        if (out == 0 || values[out - 1] != v) values[out++] = v;
+    }
+    return out;
+}
+
+// Cover ids with at most k filters sharing one mask. Starting from an exact
+// mask, greedily clear the mask bit that merges the most filter values until
+// k filters suffice. Returns the number of IDs the buffer accepts, which only
+// grows with every bit cleared; the fit gives up once it reaches bound.
+static uint64_t fitBuffer(const uint32_t* ids, size_t n, uint8_t bits, uint8_t k, uint64_t bound,
+                          uint32_t* maskOut, uint32_t* filterOut)
+{
+    // Filter values under the current mask, sorted. Clearing bit b merges
+    // every value with its partner that differs in b only; with more than
+    // PLAN_SAMPLE_VALUES values the partners of an even sample are counted.
+    static uint32_t values[CAN_ID_MAX];
+    uint32_t mask = (1UL << bits) - 1;
+    size_t distinct = countDistinct(ids, n, mask);
+    memcpy(values, scratch, distinct * sizeof(uint32_t));
+
+    while (distinct > k)
+    {
+        uint64_t accepted = (uint64_t)distinct << (bits - __builtin_popcount(mask));
+        if (accepted >= bound) return bound;
+        // Every combination of the mask bits is a filter value already, the
+        // buffer accepts every ID whatever bits are cleared
+        if (distinct == 1UL << __builtin_popcount(mask))
+        {
+            mask = 0;
+            distinct = 1;
+            values[0] = 0;
+            break;
+        }
+
+        size_t stride = distinct > PLAN_SAMPLE_VALUES ? distinct / PLAN_SAMPLE_VALUES : 1;
+        int bestBit = -1;
+        size_t bestPairs = 0;
+        for (int b = 0; b < bits; b++)
+        {
+            if (!(mask & (1UL << b))) continue;
+            size_t pairs = 0;
+            for (size_t i = 0; i < distinct; i += stride)
+            {
+                pairs += std::binary_search(values, values + distinct, values[i] ^ (1UL << b));
+            }
+            if (bestBit < 0 || pairs > bestPairs)
+            {
+                bestPairs = pairs;
+                bestBit = b;
+            }
+        }
+        distinct = clearBit(values, distinct, 1UL << bestBit);
+        mask &= ~(1UL << bestBit);
+    }
+
+    if (maskOut)
+    {
+        memcpy(scratch, values, distinct * sizeof(uint32_t));
+        *maskOut = mask;
+        for (uint8_t i = 0; i < k; i++)
+        {
+            filterOut[i] = scratch[i < distinct ? i : 0];
+        }
+    }
+    return (uint64_t)distinct << (bits - __builtin_popcount(mask));
+}
+
+// IDs both buffers let through: distinct filters of the same ID type overlap
+// where they agree in the bits both masks compare
+static uint64_t overlap(const HwFilterPlan& plan)
+{
+    if (plan.ext[0] != plan.ext[1]) return 0;
+    uint8_t bits = plan.ext[0] ? 29 : 11;
+    uint32_t both = plan.mask[0] & plan.mask[1];
+    uint64_t cell = 1ULL << (bits - __builtin_popcount(plan.mask[0] | plan.mask[1]));
+    uint64_t total = 0;
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        if (i == 1 && plan.filter[1] == plan.filter[0]) continue;
+        for (uint8_t j = 2; j < 6; j++)
+        {
+            bool repeated = false;
+            for (uint8_t r = 2; r < j; r++) repeated |= plan.filter[r] == plan.filter[j];
+            if (!repeated && ((plan.filter[i] ^ plan.filter[j]) & both) == 0) total += cell;
+        }
+    }
+    return total;
+}
+
+// Accepted IDs of a split, counted twice where the buffers overlap; at least
+// bound when the split is no better than that
+static uint64_t splitCost(const uint32_t* rxb0, size_t n0, const uint32_t* rxb1, size_t n1, uint8_t bits,
+                          uint64_t bound)
+{
+    uint64_t cost = fitBuffer(rxb0, n0, bits, 2, bound, NULL, NULL);
+    if (cost >= bound) return cost;
+    return cost + fitBuffer(rxb1, n1, bits, 4, bound - cost, NULL, NULL);
+}
+
+static void fillPlan(HwFilterPlan& plan, const uint32_t* rxb0, size_t n0, bool ext0,
+                     const uint32_t* rxb1, size_t n1, bool ext1)
+{
+    // An empty buffer repeats an ID of the other one, so it adds nothing
+    if (n0 == 0)
+    {
+        rxb0 = rxb1;
+        n0 = 1;
+        ext0 = ext1;
+    }
+    if (n1 == 0)
+    {
+        rxb1 = rxb0;
+        n1 = 1;
+        ext1 = ext0;
+    }
+    plan.ext[0] = ext0;
+    plan.ext[1] = ext1;
+    plan.accepted = fitBuffer(rxb0, n0, ext0 ? 29 : 11, 2, UINT64_MAX, &plan.mask[0], &plan.filter[0]);
+    plan.accepted += fitBuffer(rxb1, n1, ext1 ? 29 : 11, 4, UINT64_MAX, &plan.mask[1], &plan.filter[2]);
+    plan.accepted -= overlap(plan);
+}
+
+// All IDs of one type: choose which IDs go to the two-filter buffer
+static void planSingleType(const uint32_t* ids, size_t n, bool ext, HwFilterPlan& plan)
+{
+    static uint32_t rxb0[CAN_ID_MAX];
+    static uint32_t rxb1[CAN_ID_MAX];
+    uint8_t bits = ext ? 29 : 11;
+
+    // Contiguous runs of the sorted list, taken from either end
+    size_t bestCut = 0;
+    bool bestFromTop = false;
+    uint64_t bestCost = UINT64_MAX;
+    size_t step = n <= PLAN_FULL_SPLIT_MAX ? 1 : n / 32;
+    if (step < n / (PLAN_MAX_CUTS - 1)) step = n / (PLAN_MAX_CUTS - 1);
+    // Nothing beats a plan that lets through the listed IDs only
+    for (size_t cut = 0; cut <= n && bestCost > n; cut += step)
+    {
+        uint64_t low = splitCost(ids, cut, ids + cut, n - cut, bits, bestCost);
+        uint64_t high = splitCost(ids + n - cut, cut, ids, n - cut, bits, bestCost);
+        if (low < bestCost)
+        {
+            bestCost = low;
+            bestCut = cut;
+            bestFromTop = false;
+        }
+        if (high < bestCost)
+        {
+            bestCost = high;
+            bestCut = cut;
+            bestFromTop = true;
+        }
+    }
+
+    bool inRxb0[CAN_ID_MAX];
+    for (size_t i = 0; i < n; i++)
+    {
+        inRxb0[i] = bestFromTop ? i >= n - bestCut : i < bestCut;
+    }
+
+    // Move single IDs between the buffers while that lowers the cost
+    bool improved = n <= PLAN_CLIMB_MAX;
+    while (improved)
+    {
+        improved = false;
+        for (size_t m = 0; m < n; m++)
+        {
+            inRxb0[m] = !inRxb0[m];
+            size_t n0 = 0;
+            size_t n1 = 0;
+            for (size_t i = 0; i < n; i++)
+            {
+                if (inRxb0[i])
+                    rxb0[n0++] = ids[i];
+                else
+                    rxb1[n1++] = ids[i];
+            }
+            uint64_t cost = splitCost(rxb0, n0, rxb1, n1, bits, bestCost);
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                improved = true;
+            }
+            else
+            {
+                inRxb0[m] = !inRxb0[m];
+            }
+        }
+    }
+
+    size_t n0 = 0;
+    size_t n1 = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (inRxb0[i])
+            rxb0[n0++] = ids[i];
+        else
+            rxb1[n1++] = ids[i];
+    }
+    fillPlan(plan, rxb0, n0, ext, rxb1, n1, ext);
+}
+
+void planHardwareFilter(const CanIdFilter& filter, HwFilterPlan& plan)
+{
+    const uint32_t* stdIds = filter.standardIds();
+    const uint32_t* extIds = filter.extendedIds();
+    size_t nStd = filter.standardCount();
+    size_t nExt = filter.extendedCount();
+
+    if (nExt == 0)
+    {
+        planSingleType(stdIds, nStd, false, plan);
+    }
+    else if (nStd == 0)
+    {
+        planSingleType(extIds, nExt, true, plan);
+    }
+    else
+    {
+        // Filters match one ID type each, so give each type its own buffer
+        HwFilterPlan other;
+        fillPlan(plan, stdIds, nStd, false, extIds, nExt, true);
+        fillPlan(other, extIds, nExt, true, stdIds, nStd, false);
+        if (other.accepted < plan.accepted) plan = other;
+    }
+}
+
+void applyHardwareFilter(const HwFilterPlan& plan)
+{
+    // Standard IDs sit in the upper half of the register value, the lower
+    // half would match the first two data bytes and stays zero
+    for (uint8_t b = 0; b < 2; b++)
+    {
+        CAN0.init_Mask(b, plan.ext[b], plan.ext[b] ? plan.mask[b] : plan.mask[b] << 16);
+    }
+    for (uint8_t f = 0; f < 6; f++)
+    {
+        bool ext = plan.ext[f < 2 ? 0 : 1];
+        CAN0.init_Filt(f, ext, ext ? plan.filter[f] : plan.filter[f] << 16);
+    }
+    telemetryEvent(EVENT_ID_FILTER, ID_FILTER_RXB0_MASK, plan.mask[0]);
+    telemetryEvent(EVENT_ID_FILTER, ID_FILTER_RXB1_MASK, plan.mask[1]);
+    telemetryEvent(EVENT_ID_FILTER, ID_FILTER_ACCEPTED, (uint32_t)std::min<uint64_t>(plan.accepted, UINT32_MAX));
+}
@@ -0,0 +1,39 @@
+#include "log_histogram.h"
+
+// Four buckets per power of two: the octave and the two bits below the
+// leading one. Values below 4 get a bucket each.
+static uint8_t bucketOf(uint32_t value)
+{
+    if (value < 4) return value;
+    uint8_t octave = 31 - __builtin_clz(value);
+    return (octave - 1) * 4 + ((value >> (octave - 2)) & 3);
+}
+
+// Largest value that falls into a bucket
+static uint32_t bucketLimit(uint8_t bucket)
+{
+    if (bucket < 4) return bucket;
+    uint8_t octave = bucket / 4 + 1;
+    uint32_t base = 1UL << octave;
+    return base + (bucket % 4 + 1) * (base >> 2) - 1;
+}
+
+void LogHistogram::record(uint32_t value)
+{
+    if (count == 0 || value < min) min = value;
+    if (value > max) max = value;
+    count++;
+    sum += value;
+    buckets[bucketOf(value)]++;
+}
+
+uint32_t LogHistogram::quantile(uint16_t perMille) const
+{
+    if (count == 0) return 0;
+    uint32_t rank = count - (uint32_t)((uint64_t)count * (1000 - perMille) / 1000);
+    uint32_t seen = 0;
+    uint8_t b = 0;
+    while (b < LOG_HISTOGRAM_BUCKETS - 1 && (seen += buckets[b]) < rank) b++;
+    uint32_t limit = bucketLimit(b);
+    return limit < max ? limit : max;
+}
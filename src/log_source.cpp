@@ -0,0 +1,297 @@
+#include "log_source.h"
+#include "lz4.h"
+#include "telemetry.h"
+#include <esp32/rom/miniz.h>
+
+// ==================== Plain File ====================
+
+class FileSource : public LogSource
+{
+public:
+    explicit FileSource(File& file) : file(file) {}
+    size_t read(uint8_t* buf, size_t n) override { return file.read(buf, n); }
+    const char* name() const override { return "text"; }
+
+private:
+    File& file;
+};
+
+// ==================== LZ4 Frame ====================
+
+#define LZ4_HISTORY 65536
+
+// Streams the blocks of one or more concatenated LZ4 frames. Linked blocks
+// may refer to the previous 64 KB of output, which stays in front of the
+// block in the output window.
+class Lz4Source : public LogSource
+{
+public:
+    explicit Lz4Source(File& file) : file(file) {}
+    ~Lz4Source() override
+    {
+        free(in);
+        free(window);
+    }
+    bool begin();
+    size_t read(uint8_t* buf, size_t n) override;
+    const char* name() const override { return "lz4"; }
+
+private:
+    bool readFrameHeader();
+    bool nextBlock();
+
+    File& file;
+    uint8_t* in = nullptr;
+    uint8_t* window = nullptr; // LZ4_HISTORY of history followed by one block
+    size_t maxBlock = 0;
+    size_t pos = 0;
+    size_t len = 0;
+    bool blockChecksum = false;
+    bool contentChecksum = false;
+    bool linked = false;
+    bool ended = false;
+};
+
+bool Lz4Source::readFrameHeader()
+{
+    uint8_t h[LZ4_FRAME_HEADER_SIZE - 4 + 12];
+    uint32_t magic;
+    if (file.read((uint8_t*)&magic, 4) != 4 || magic != LZ4_FRAME_MAGIC) return false;
+    if (file.read(h, 2) != 2) return false;
+
+    uint8_t flg = h[0];
+    uint8_t bd = h[1];
+    if ((flg >> 6) != 1) return false;
+    linked = !(flg & 0x20);
+    blockChecksum = flg & 0x10;
+    contentChecksum = flg & 0x04;
+
+    // Content size, dictionary ID and header checksum are skipped
+    size_t extra = ((flg & 0x08) ? 8 : 0) + ((flg & 0x01) ? 4 : 0) + 1;
+    if (file.read(h + 2, extra) != extra) return false;
+
+    size_t blockSize = (size_t)1 << (8 + 2 * ((bd >> 4) & 7));
+    if (blockSize > maxBlock)
+    {
+        telemetryEvent(EVENT_SOURCE, SOURCE_LZ4_BLOCK_SIZE, blockSize / 1024);
+        return false;
+    }
+    return true;
+}
+
+bool Lz4Source::begin()
+{
+    maxBlock = LZ4_SOURCE_MAX_BLOCK;
+    in = (uint8_t*)ps_malloc(maxBlock);
+    window = (uint8_t*)ps_malloc(LZ4_HISTORY + maxBlock);
+    if (!in || !window) return false;
+    pos = len = LZ4_HISTORY;
+    return readFrameHeader();
+}
+
+bool Lz4Source::nextBlock()
+{
+    uint32_t size;
+    while (true)
+    {
+        if (file.read((uint8_t*)&size, 4) != 4) return false;
+        if (size != 0) break;
+
+        // End mark, another frame may follow
+        if (contentChecksum) file.seek(file.position() + 4);
+        if (file.available() < 4 || !readFrameHeader()) return false;
+    }
+
+    bool stored = size & LZ4_UNCOMPRESSED_BIT;
+    size &= ~LZ4_UNCOMPRESSED_BIT;
+    if (size > maxBlock) return false;
+
+    // Keep the last 64 KB in front of the new block for linked frames
+    if (linked && len > LZ4_HISTORY)
+    {
+        memmove(window, window + len - LZ4_HISTORY, LZ4_HISTORY);
+    }
+    uint8_t* dst = window + LZ4_HISTORY;
+
+    int32_t n;
+    if (stored)
+    {
+        n = file.read(dst, size);
+        if ((size_t)n != size) return false;
+    }
+    else
+    {
+        if (file.read(in, size) != size) return false;
+        n = lz4Decompress(in, size, dst, maxBlock, linked ? window : dst);
+        if (n < 0)
+        {
+            telemetryEvent(EVENT_SOURCE, SOURCE_LZ4_CORRUPT, 0);
+            return false;
+        }
+    }
+    if (blockChecksum) file.seek(file.position() + 4);
+
+    pos = LZ4_HISTORY;
+    len = LZ4_HISTORY + n;
+    return true;
+}
+
+size_t Lz4Source::read(uint8_t* buf, size_t n)
+{
+    size_t copied = 0;
+    while (copied < n && !ended)
+    {
+        if (pos == len && !nextBlock())
+        {
+            ended = true;
+            break;
+        }
+        size_t chunk = min(n - copied, len - pos);
+        memcpy(buf + copied, window + pos, chunk);
+        pos += chunk;
+        copied += chunk;
+    }
+    return copied;
+}
+
+// ==================== gzip ====================
+
+// Inflates the first gzip member with the tinfl decoder in the ESP32 ROM,
+// which needs a 32 KB circular dictionary.
+class GzipSource : public LogSource
+{
+public:
+    explicit GzipSource(File& file) : file(file) {}
+    ~GzipSource() override
+    {
+        free(in);
+        free(dict);
+        free(inflator);
+    }
+    bool begin();
+    size_t read(uint8_t* buf, size_t n) override;
+    const char* name() const override { return "gzip"; }
+
+private:
+    bool skipHeader();
+
+    File& file;
+    tinfl_decompressor* inflator = nullptr;
+    uint8_t* in = nullptr;
+    uint8_t* dict = nullptr;
+    size_t inPos = 0;
+    size_t inLen = 0;
+    size_t dictPos = 0;  // where tinfl writes next
+    size_t outPos = 0;   // next byte handed out
+    size_t outAvail = 0; // bytes decoded but not handed out
+    bool inputEnded = false;
+    bool ended = false;
+};
+
+bool GzipSource::skipHeader()
+{
+    uint8_t h[10];
+    if (file.read(h, 10) != 10 || h[0] != 0x1F || h[1] != 0x8B || h[2] != 8) return false;
+    uint8_t flags = h[3];
+    if (flags & 0x04) // FEXTRA
+    {
+        uint8_t xlen[2];
+        if (file.read(xlen, 2) != 2) return false;
+        file.seek(file.position() + (xlen[0] | xlen[1] << 8));
+    }
+    for (uint8_t bit = 0x08; bit <= 0x10; bit <<= 1) // FNAME, FCOMMENT
+    {
+        if (!(flags & bit)) continue;
+        int c;
+        while ((c = file.read()) > 0)
+        {
+        }
+        if (c < 0) return false;
+    }
+    if (flags & 0x02) file.seek(file.position() + 2); // FHCRC
+    return true;
+}
+
+bool GzipSource::begin()
+{
+    inflator = (tinfl_decompressor*)ps_malloc(sizeof(tinfl_decompressor));
+    in = (uint8_t*)ps_malloc(SOURCE_READ_SIZE);
+    dict = (uint8_t*)ps_malloc(TINFL_LZ_DICT_SIZE);
+    if (!inflator || !in || !dict) return false;
+    tinfl_init(inflator);
+    return skipHeader();
+}
+
+size_t GzipSource::read(uint8_t* buf, size_t n)
+{
+    size_t copied = 0;
+    while (copied < n)
+    {
+        if (outAvail > 0)
+        {
+            size_t chunk = min(n - copied, outAvail);
+            memcpy(buf + copied, dict + outPos, chunk);
+            outPos += chunk;
+            outAvail -= chunk;
+            copied += chunk;
+            continue;
+        }
+        if (ended) break;
+
+        if (inPos == inLen && !inputEnded)
+        {
+            inLen = file.read(in, SOURCE_READ_SIZE);
+            inPos = 0;
+            inputEnded = inLen == 0;
+        }
+
+        size_t inBytes = inLen - inPos;
+        size_t outBytes = TINFL_LZ_DICT_SIZE - dictPos;
+        tinfl_status status = tinfl_decompress(inflator, in + inPos, &inBytes, dict, dict + dictPos, &outBytes,
+                                               inputEnded ? 0 : TINFL_FLAG_HAS_MORE_INPUT);
+        inPos += inBytes;
+        outPos = dictPos;
+        outAvail = outBytes;
+        dictPos = (dictPos + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+
+        if (status < TINFL_STATUS_DONE)
+        {
+            telemetryEvent(EVENT_SOURCE, SOURCE_GZIP_ERROR, (uint32_t)status);
+            ended = true;
+        }
+        else if (status == TINFL_STATUS_DONE || (inputEnded && outBytes == 0))
+        {
+            ended = true;
+        }
+    }
+    return copied;
+}
+
+// ==================== Format Detection ====================
+
+LogSource* openLogSource(File& file)
+{
+    uint8_t magic[4] = {};
+    file.read(magic, 4);
+    file.seek(0);
+
+    if (magic[0] == 0x1F && magic[1] == 0x8B)
+    {
+        GzipSource* gz = new GzipSource(file);
+        if (gz->begin()) return gz;
+        delete gz;
+        return NULL;
+    }
+
+    uint32_t word;
+    memcpy(&word, magic, 4);
+    if (word == LZ4_FRAME_MAGIC)
+    {
+        Lz4Source* lz4 = new Lz4Source(file);
+        if (lz4->begin()) return lz4;
+        delete lz4;
+        return NULL;
+    }
+
+    return new FileSource(file);
+}
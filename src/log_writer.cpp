@@ -0,0 +1,69 @@
+#include "log_writer.h"
+#include "candump.h"
+#include "telemetry.h"
+
+File openNextLogFile(const char* prefix, const char* ext)
+{
+    char path[48];
+    for (int n = 0; n < 10000; n++)
+    {
+        snprintf(path, sizeof(path), "%s/%s%04d%s", LOG_DIR, prefix, n, ext);
+        if (!SD.exists(path))
+        {
+            telemetryEvent(EVENT_RECORDING, RECORDING_FILE, n);
+            return SD.open(path, FILE_WRITE);
+        }
+    }
+    return File();
+}
+
+void syncSectorTail(File& file, const char* buffer, size_t used)
+{
+    size_t position = file.position();
+    if (used > 0) file.write((const uint8_t*)buffer, used);
+    file.flush();
+    if (used > 0) file.seek(position);
+}
+
+// ==================== Candump Writer ====================
+
+bool CandumpWriter::begin()
+{
+    file = openNextLogFile("can_", ".log");
+    used = 0;
+    return (bool)file;
+}
+
+void CandumpWriter::write(const CanFrame& frame)
+{
+    char line[CANDUMP_MAX_LINE];
+    size_t n = formatCandump(frame, line);
+
+    // Fill the buffer up to the sector boundary, the rest of the line
+    // starts the next sector
+    size_t room = BUFFER_SIZE - used;
+    if (n >= room)
+    {
+        memcpy(buffer + used, line, room);
+        file.write((const uint8_t*)buffer, BUFFER_SIZE);
+        memcpy(buffer, line + room, n - room);
+        used = n - room;
+    }
+    else
+    {
+        memcpy(buffer + used, line, n);
+        used += n;
+    }
+}
+
+void CandumpWriter::flush()
+{
+    syncSectorTail(file, buffer, used);
+}
+
+void CandumpWriter::end()
+{
+    if (used > 0) file.write((const uint8_t*)buffer, used);
+    used = 0;
+    file.close();
+}
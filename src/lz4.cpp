@@ -0,0 +1,233 @@
+#include "lz4.h"
+
+#define MIN_MATCH 4
+#define LAST_LITERALS 5 // the block always ends in literals
+#define MF_LIMIT 12     // no match may start in the last 12 bytes
+#define MAX_OFFSET 65535
+
+static inline uint32_t read32(const uint8_t* p)
+{
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static inline uint32_t hashSequence(uint32_t seq)
+{
+    return (uint32_t)(seq * 2654435761U) >> 20; // 12 bits, LZ4_HASH_ENTRIES
+}
+
+// Length fields continue in extra bytes of 255 once the 4-bit nibble is full
+static inline uint8_t* putLength(uint8_t* op, size_t len)
+{
+    while (len >= 255)
+    {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = (uint8_t)len;
+    return op;
+}
+
+static uint8_t* putSequence(uint8_t* op, const uint8_t* literals, size_t literalLen,
+                            size_t offset, size_t matchLen, bool last)
+{
+    uint8_t* token = op++;
+    *token = (literalLen >= 15 ? 15 : literalLen) << 4;
+    if (literalLen >= 15) op = putLength(op, literalLen - 15);
+    memcpy(op, literals, literalLen);
+    op += literalLen;
+    if (last) return op;
+
+    *op++ = offset & 0xFF;
+    *op++ = offset >> 8;
+    matchLen -= MIN_MATCH;
+    *token |= matchLen >= 15 ? 15 : matchLen;
+    if (matchLen >= 15) op = putLength(op, matchLen - 15);
+    return op;
+}
+
+// Greedy single-probe matcher, the same strategy as LZ4's fast mode
+size_t lz4Compress(const uint8_t* src, size_t n, uint8_t* dst, uint16_t* table)
+{
+    const uint8_t* ip = src;
+    const uint8_t* anchor = src;
+    const uint8_t* end = src + n;
+    uint8_t* op = dst;
+
+    memset(table, 0, LZ4_HASH_ENTRIES * sizeof(uint16_t));
+
+    if (n > MF_LIMIT)
+    {
+        const uint8_t* mfLimit = end - MF_LIMIT;
+        const uint8_t* matchLimit = end - LAST_LITERALS;
+
+        while (ip < mfLimit)
+        {
+            uint32_t seq = read32(ip);
+            uint32_t h = hashSequence(seq);
+            const uint8_t* ref = src + table[h];
+            table[h] = (uint16_t)(ip - src);
+
+            if (ref >= ip || ip - ref > MAX_OFFSET || read32(ref) != seq)
+            {
+                ip++;
+                continue;
+            }
+
+            while (ip > anchor && ref > src && ip[-1] == ref[-1])
+            {
+                ip--;
+                ref--;
+            }
+            const uint8_t* m = ip + MIN_MATCH;
+            const uint8_t* r = ref + MIN_MATCH;
+            while (m < matchLimit && *m == *r)
+            {
+                m++;
+                r++;
+            }
+
+            op = putSequence(op, anchor, ip - anchor, ip - ref, m - ip, false);
+            ip = m;
+            anchor = ip;
+        }
+    }
+
+    op = putSequence(op, anchor, end - anchor, 0, 0, true);
+    return op - dst;
+}
+
+void lz4FrameHeader(uint8_t header[LZ4_FRAME_HEADER_SIZE])
+{
+    uint32_t magic = LZ4_FRAME_MAGIC;
+    memcpy(header, &magic, 4);
+    header[4] = 0x60; // version 01, independent blocks
+    header[5] = 0x40; // 64 KB maximum block size
+    header[6] = (xxh32(header + 4, 2, 0) >> 8) & 0xFF;
+}
+
+// ==================== xxHash32 ====================
+
+#define XXH_PRIME1 2654435761U
+#define XXH_PRIME2 2246822519U
+#define XXH_PRIME3 3266489917U
+#define XXH_PRIME4 668265263U
+#define XXH_PRIME5 374761393U
+
+static inline uint32_t rotl32(uint32_t x, int r)
+{
+    return (x << r) | (x >> (32 - r));
+}
+
+static inline uint32_t xxhRound(uint32_t acc, uint32_t input)
+{
+    acc += input * XXH_PRIME2;
+    return rotl32(acc, 13) * XXH_PRIME1;
+}
+
+uint32_t xxh32(const uint8_t* p, size_t n, uint32_t seed)
+{
+    const uint8_t* end = p + n;
+    uint32_t h;
+
+    if (n >= 16)
+    {
+        uint32_t v1 = seed + XXH_PRIME1 + XXH_PRIME2;
+        uint32_t v2 = seed + XXH_PRIME2;
+        uint32_t v3 = seed;
+        uint32_t v4 = seed - XXH_PRIME1;
+        const uint8_t* limit = end - 16;
+        do
+        {
+            v1 = xxhRound(v1, read32(p));
+            v2 = xxhRound(v2, read32(p + 4));
+            v3 = xxhRound(v3, read32(p + 8));
+            v4 = xxhRound(v4, read32(p + 12));
+            p += 16;
+        } while (p <= limit);
+        h = rotl32(v1, 1) + rotl32(v2, 7) + rotl32(v3, 12) + rotl32(v4, 18);
+    }
+    else
+    {
+        h = seed + XXH_PRIME5;
+    }
+    h += (uint32_t)n;
+
+    while (p + 4 <= end)
+    {
+        h += read32(p) * XXH_PRIME3;
+        h = rotl32(h, 17) * XXH_PRIME4;
+        p += 4;
+    }
+    while (p < end)
+    {
+        h += (*p++) * XXH_PRIME5;
+        h = rotl32(h, 11) * XXH_PRIME1;
+    }
+
+    h ^= h >> 15;
+    h *= XXH_PRIME2;
+    h ^= h >> 13;
+    h *= XXH_PRIME3;
+    h ^= h >> 16;
+    return h;
+}
+
+// ==================== Decompression ====================
+
+static inline bool getLength(const uint8_t*& ip, const uint8_t* end, size_t& len)
+{
+    uint8_t b;
+    do
+    {
+        if (ip >= end) return false;
+        b = *ip++;
+        len += b;
+    } while (b == 255);
+    return true;
+}
+
+int32_t lz4Decompress(const uint8_t* src, size_t n, uint8_t* dst, size_t capacity, const uint8_t* history)
+{
+    const uint8_t* ip = src;
+    const uint8_t* end = src + n;
+    uint8_t* op = dst;
+    uint8_t* opEnd = dst + capacity;
+
+    while (ip < end)
+    {
+        uint8_t token = *ip++;
+
+        size_t literalLen = token >> 4;
+        if (literalLen == 15 && !getLength(ip, end, literalLen)) return -1;
+        if ((size_t)(end - ip) < literalLen || (size_t)(opEnd - op) < literalLen) return -1;
+        memcpy(op, ip, literalLen);
+        ip += literalLen;
+        op += literalLen;
+        if (ip == end) break; // last sequence has no match
+
+        if (end - ip < 2) return -1;
+        size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        const uint8_t* ref = op - offset;
+        if (offset == 0 || ref < history) return -1;
+
+        size_t matchLen = token & 15;
+        if (matchLen == 15 && !getLength(ip, end, matchLen)) return -1;
+        matchLen += MIN_MATCH;
+        if ((size_t)(opEnd - op) < matchLen) return -1;
+
+        // Overlapping copies repeat the pattern, so copy forward bytewise
+        if (offset >= matchLen)
+        {
+            memcpy(op, ref, matchLen);
+            op += matchLen;
+        }
+        else
+        {
+            while (matchLen--) *op++ = *ref++;
+        }
+    }
+    return op - dst;
+}
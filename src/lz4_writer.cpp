@@ -0,0 +1,72 @@
+#include <esp_timer.h>
+#include "lz4_writer.h"
+#include "candump.h"
+#include "metrics.h"
+
+static_assert(LZ4_BLOCK_SIZE <= 65536, "LZ4 blocks are limited to 64 KB");
+
+bool Lz4CandumpWriter::begin()
+{
+    in = (uint8_t*)malloc(LZ4_BLOCK_SIZE);
+    out = (uint8_t*)malloc(LZ4_COMPRESS_BOUND(LZ4_BLOCK_SIZE));
+    table = (uint16_t*)malloc(LZ4_HASH_ENTRIES * sizeof(uint16_t));
+    if (!in || !out || !table) return false;
+
+    file = openNextLogFile("can_", ".log.lz4");
+    if (!file) return false;
+
+    uint8_t header[LZ4_FRAME_HEADER_SIZE];
+    lz4FrameHeader(header);
+    file.write(header, sizeof(header));
+    used = 0;
+    return true;
+}
+
+void Lz4CandumpWriter::writeBlock()
+{
+    int64_t start = esp_timer_get_time();
+    size_t n = lz4Compress(in, used, out + 4, table);
+    metricAdd(METRIC_LZ4_MICROS, esp_timer_get_time() - start);
+
+    // Incompressible input is stored as is, flagged in the size word
+    uint32_t size = n;
+    const uint8_t* data = out + 4;
+    if (n >= used)
+    {
+        size = used | LZ4_UNCOMPRESSED_BIT;
+        n = used;
+        data = in;
+    }
+    file.write((const uint8_t*)&size, 4);
+    file.write(data, n);
+
+    metricAdd(METRIC_LZ4_BLOCKS);
+    metricAdd(METRIC_LZ4_IN_BYTES, used);
+    metricAdd(METRIC_LZ4_OUT_BYTES, n + 4);
+    used = 0;
+}
+
+void Lz4CandumpWriter::write(const CanFrame& frame)
+{
+    if (used + CANDUMP_MAX_LINE > LZ4_BLOCK_SIZE) writeBlock();
+    used += formatCandump(frame, (char*)in + used);
+}
+
+void Lz4CandumpWriter::flush()
+{
+    if (used > 0) writeBlock();
+    file.flush();
+}
+
+void Lz4CandumpWriter::end()
+{
+    flush();
+    uint32_t endMark = 0;
+    file.write((const uint8_t*)&endMark, 4);
+    file.close();
+    free(in);
+    free(out);
+    free(table);
+    in = out = nullptr;
+    table = nullptr;
+}
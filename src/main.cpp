@@ -2,23 +2,105 @@
 #include <mcp_can.h>
 #include <SPI.h>
 #include <SD.h>
-#include "m5_logo.h"
+#include <esp_timer.h>
+#include "config.h"
+#include "can_bus.h"
+#include "recorder.h"
+#include "trigger_capture.h"
+#include "can_id_filter.h"
+#include "hw_filter.h"
+#include "replay.h"
+#include "status_display.h"
+#include "splash.h"
+#include "serial_commands.h"
+#include "stage_profiler.h"
+#include "trace_buffer.h"
+#include "telemetry.h"
+#include "metrics.h"
+#include "resource_monitor.h"
+#include "sampling_profiler.h"
 
 // MCP2515 setup
-MCP_CAN CAN0(12); // CS pin
+MCP_CAN CAN0(CAN0_CS);
 
 // SD Card settings
-unsigned long lastDisplayUpdate = 0;
-unsigned long lastMessageCount = 0;
-unsigned long messagesPerSecond = 0;
 File root;
 File dataFile;
-unsigned long transmitCount = 0;
 bool fileFound = false;
+bool recordMode = false;
 
-bool initCAN();
-void CANTransmitTask(void* pvParameters);
-void displayMessageCount();
+bool isConfigFile(const char* name);
+
+// Results of BootInitTask, valid once bootDone is given
+struct BootState
+{
+    bool sdReady;
+    bool filterLoaded;
+    bool scanned;
+    bool canReady;
+    bool canRetried;
+    // Phase end times in microseconds since reset
+    int64_t displayUs;
+    int64_t splashUs;
+    int64_t sdUs;
+    int64_t scanUs;
+    int64_t canUs;
+    int64_t readyUs;
+};
+
+static BootState boot;
+static HwFilterPlan filterPlan; // made once, also used by the CAN retry
+static SemaphoreHandle_t bootDone = NULL;
+static bool firstFrameLogged = false;
+
+// Mounts the SD card, loads the ID filter, looks for a file to replay and
+// brings up the MCP2515 on core 0 while setup() draws the splash on core 1.
+// Nothing here touches the LCD; the outcome is printed after the splash.
+void BootInitTask(void* pvParameters)
+{
+    boot.sdReady = SD.begin(GPIO_NUM_4, SPI, 25000000);
+    boot.sdUs = esp_timer_get_time();
+    if (boot.sdReady)
+    {
+        boot.filterLoaded = idFilter.load(CAN_ID_FILE);
+        if (idFilter.enabled()) planHardwareFilter(idFilter, filterPlan);
+
+        if (!recordMode)
+        {
+            root = SD.open("/");
+            while (true)
+            {
+                dataFile = root.openNextFile();
+                if (!dataFile) break;
+                if (!dataFile.isDirectory() && !isConfigFile(dataFile.name()))
+                {
+                    telemetryEvent(EVENT_REPLAY, REPLAY_FILE_FOUND, dataFile.size());
+                    fileFound = true;
+                    break;
+                }
+                dataFile.close();
+            }
+            // Nothing to replay, act as a logger instead
+            recordMode = !fileFound;
+            boot.scanned = true;
+        }
+    }
+    boot.scanUs = esp_timer_get_time();
+
+    // Initialize CAN bus
+    const HwFilterPlan* plan = idFilter.enabled() ? &filterPlan : NULL;
+    boot.canReady = initCAN(plan);
+    if (!boot.canReady)
+    {
+        boot.canRetried = true;
+        delay(1000);
+        boot.canReady = initCAN(plan);
+    }
+    boot.canUs = esp_timer_get_time();
+
+    xSemaphoreGive(bootDone);
+    vTaskDelete(NULL);
+}
 
 void setup()
 {
@@ -29,206 +111,116 @@ void setup()
     M5.Lcd.setRotation(1);
     M5.Lcd.setTextSize(1);
 
-    Serial.begin(115200);
-    M5.Lcd.pushImage(0, 0, 320, 240, (uint16_t*)gImage_logoM5);
-    delay(1000);
+    Serial.begin(TELEMETRY_BAUD);
+    beginTelemetry();
+    beginStageProfiler();
+    beginTraceBuffer();
+    beginMetrics();
+    beginResourceMonitor();
+    beginSamplingProfiler();
+    boot.displayUs = esp_timer_get_time();
+
+    // Holding BtnB during boot selects record mode
+    M5.update();
+    recordMode = M5.BtnB.isPressed();
+
+    // The bus is set up here, before the LCD is busy with the splash; later
+    // SPI.begin() calls from the SD and CAN drivers are then no-ops
+    SPI.begin();
+    bootDone = xSemaphoreCreateBinary();
+    xTaskCreatePinnedToCore(BootInitTask, "BootInit", 8192, NULL, 1, NULL, 0);
+
+    drawSplash();
+    boot.splashUs = esp_timer_get_time();
+    xSemaphoreTake(bootDone, portMAX_DELAY);
     M5.Lcd.clear();
 
-    // Init SD card
-    if (!SD.begin(GPIO_NUM_4, SPI, 25000000))
+    if (!boot.sdReady)
     {
         M5.Lcd.println("SD init failed!");
     }
     else
     {
-        root = SD.open("/");
-        while (true)
+        if (boot.filterLoaded)
         {
-            dataFile = root.openNextFile();
-            if (!dataFile)
-            {
-                M5.Lcd.println("No files on SD!");
-                break;
-            }
-            if (!dataFile.isDirectory())
-            {
-                M5.Lcd.printf("Found file: %s\n", dataFile.name());
-                Serial.printf("Found file: %s\n", dataFile.name());
-                fileFound = true;
-                break;
-            }
-            dataFile.close();
+            M5.Lcd.printf("ID filter: %s\n", CAN_ID_FILE);
+        }
+        if (fileFound)
+        {
+            M5.Lcd.printf("Found file: %s\n", dataFile.name());
+        }
+        else if (boot.scanned)
+        {
+            M5.Lcd.println("No files on SD!");
         }
     }
-
-    // Initialize CAN bus
-    if (!initCAN())
+    if (boot.canRetried)
     {
-        M5.Lcd.println("CAN Init Failed! Retrying...");
-        delay(1000);
-        initCAN();
+        M5.Lcd.println(boot.canReady ? "CAN Init Failed! Retried" : "CAN Init Failed!");
     }
 
-    if (fileFound)
+    if (recordMode)
     {
-        // Start transmit task
-        xTaskCreatePinnedToCore(CANTransmitTask, "CANTransmit", 8192, NULL, 1, NULL, 1);
+        if (!startRecorder())
+        {
+            M5.Lcd.println("Recorder start failed!");
+        }
+    }
+    else if (fileFound)
+    {
+        // Start reader and transmit tasks
+        if (!startReplay(dataFile))
+        {
+            M5.Lcd.println("Cannot read log file!");
+        }
     }
 
     // Initial display
     M5.Lcd.setCursor(0, 0);
-    M5.Lcd.println("CAN Messages Transmitted:");
-    displayMessageCount();
+    M5.Lcd.println(recordMode ? "CAN Messages Received:" : "CAN Messages Transmitted:");
+    startStatusDisplay(recordMode);
+    startTelemetry(recordMode);
+
+    boot.readyUs = esp_timer_get_time();
+    const int64_t phaseEndUs[] = {boot.displayUs, boot.splashUs, boot.sdUs, boot.scanUs, boot.canUs, boot.readyUs};
+    for (uint8_t phase = BOOT_DISPLAY; phase <= BOOT_READY; phase++)
+    {
+        telemetryEvent(EVENT_BOOT, phase, (uint32_t)(phaseEndUs[phase] / 1000));
+    }
 }
 
 void loop()
 {
     M5.update();
+    pollSerialCommands();
     if (M5.BtnA.wasPressed())
     {
-        Serial.println("BtnA pressed, shutting down...");
+        telemetryEvent(EVENT_POWER_OFF, 0, 0);
+        if (recordMode) stopRecorder();
         M5.Power.powerOff();
     }
-
-    // Update display once per second
-    if (millis() - lastDisplayUpdate >= 1000)
+    if (recordMode && M5.BtnC.wasPressed())
     {
-        lastDisplayUpdate = millis();
-        messagesPerSecond = transmitCount - lastMessageCount;
-        lastMessageCount = transmitCount;
-        displayMessageCount();
+        requestTrigger();
     }
 
-    // System monitoring
-    static uint32_t lastHeapCheck = 0;
-    if (millis() - lastHeapCheck > 5000)
+    // Time to first frame, the figure the boot sequence is tuned for
+    if (!firstFrameLogged && metricCount(recordMode ? METRIC_RECEIVED : METRIC_TRANSMITTED))
     {
-        lastHeapCheck = millis();
-        Serial.printf("System Status - Free Heap: %d, Transmitted: %lu\n",
-                      ESP.getFreeHeap(),
-                      transmitCount);
+        firstFrameLogged = true;
+        uint32_t firstMs = esp_timer_get_time() / 1000;
+        telemetryEvent(EVENT_FIRST_FRAME, firstMs > BOOT_TARGET_MS ? 1 : 0, firstMs);
     }
+    TRACE(TRACE_TASK_WAIT, TRACE_LOOP);
     delay(10);
-}
-
-// ==================== CAN Transmit Task ====================
-
-uint8_t hexToByte(char high, char low)
-{
-    auto charToHex = [](char c) -> uint8_t {
-        if (c >= '0' && c <= '9') return c - '0';
-        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
-        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
-        return 0;
-    };
-    return (charToHex(high) << 4) | charToHex(low);
-}
-
-void CANTransmitTask(void* pvParameters)
-{
-    if (!dataFile)
-    {
-        vTaskDelete(NULL);
-        return;
-    }
-
-    Serial.printf("Starting transmission of file: %s\n", dataFile.name());
-
-    double lastTimestamp = -1.0;
-
-    while (dataFile.available())
-    {
-        String line = dataFile.readStringUntil('\n');
-        line.trim();
-
-        // Format: (timestamp) can0 ID#DATA
-        // Example: (1713351000.000000) can0 123#0102030405060708
-        int openParen = line.indexOf('(');
-        int closeParen = line.indexOf(')');
-        int hashPos = line.indexOf('#');
-        int canPos = line.indexOf("can0 ");
-
-        if (hashPos != -1 && canPos != -1 && openParen != -1 && closeParen > openParen)
-        {
-            String tsStr = line.substring(openParen + 1, closeParen);
-            double currentTimestamp = strtod(tsStr.c_str(), NULL);
-
-            if (lastTimestamp >= 0)
-            {
-                double diff = currentTimestamp - lastTimestamp;
-                if (diff > 0)
-                {
-                    // Delay for the time gap between messages
-                    // vTaskDelay works in ticks, we might need more precision if gaps are very small
-                    // but for log playback vTaskDelay should be okay for ms resolution.
-                    // For better precision we could use ets_delay_us or a high res timer, 
-                    // but sticking to FreeRTOS tasks style.
-                    uint32_t delayMs = (uint32_t)(diff * 1000.0);
-                    if (delayMs > 0)
-                    {
-                        vTaskDelay(pdMS_TO_TICKS(delayMs));
-                    }
-                }
-            }
-            lastTimestamp = currentTimestamp;
-
-            String idStr = line.substring(canPos + 5, hashPos);
-            String dataStr = line.substring(hashPos + 1);
-
-            unsigned long id = strtoul(idStr.c_str(), NULL, 16);
-            uint8_t len = dataStr.length() / 2;
-            if (len > 8) len = 8;
-            uint8_t data[8];
-
-            for (int i = 0; i < len; i++)
-            {
-                data[i] = hexToByte(dataStr[i * 2], dataStr[i * 2 + 1]);
-            }
-
-            byte sndStat = CAN_FAIL;
-            uint8_t retries = 5;
-            while (retries--)
-            {
-                sndStat = CAN0.sendMsgBuf(id, 0, len, data);
-                if (sndStat == CAN_OK)
-                {
-                    transmitCount++;
-                    break;
-                }
-                else if (sndStat == CAN_GETTXBFTIMEOUT)
-                {
-                    // Bus is full or no ACK, wait a bit
-                    vTaskDelay(pdMS_TO_TICKS(10));
-                }
-                else
-                {
-                    // Other error, just log it
-                    break;
-                }
-            }
-
-            if (sndStat != CAN_OK)
-            {
-                String errStr;
-                switch(sndStat) {
-                    case CAN_GETTXBFTIMEOUT: errStr = "TX Buff Full (No ACK?)"; break;
-                    case CAN_SENDMSGTIMEOUT: errStr = "Send Msg Timeout"; break;
-                    case CAN_FAILTX:         errStr = "Fail TX"; break;
-                    case CAN_CTRLERROR:     errStr = "Controller Error"; break;
-                    default:                 errStr = String(sndStat); break;
-                }
-                Serial.printf("Error sending CAN message: %s\n", errStr.c_str());
-            }
-        }
-    }
-    dataFile.close();
-    Serial.println("Finished transmitting log file");
-    vTaskDelete(NULL);
+    TRACE(TRACE_TASK_RUN, TRACE_LOOP);
 }
 
 // ==================== Utility Functions ====================
 
-bool initCAN()
+// Start the MCP2515; with a plan only the IDs it lets through cross the SPI
+// bus, without one every frame does
+bool initCAN(const HwFilterPlan* plan)
 {
     SPI.begin();
     SPI.setClockDivider(SPI_CLOCK_DIV4);
@@ -236,9 +228,10 @@ bool initCAN()
     uint8_t retries = 3;
     while (retries--)
     {
-        if (CAN0.begin(MCP_ANY, CAN_500KBPS, MCP_8MHZ) == CAN_OK)
+        if (CAN0.begin(plan ? MCP_STDEXT : MCP_ANY, CAN_500KBPS, MCP_8MHZ) == CAN_OK)
         {
             CAN0.setMode(MCP_NORMAL);
+            if (plan) applyHardwareFilter(*plan);
             pinMode(CAN0_INT, INPUT_PULLUP);
             return true;
         }
@@ -247,17 +240,12 @@ bool initCAN()
     return false;
 }
 
-void displayMessageCount()
+// Files in the root directory that configure the logger rather than hold
+// frames to replay
+bool isConfigFile(const char* name)
 {
-    M5.Lcd.fillRect(0, 20, 320, 60, BLACK); // Clear display area
-    M5.Lcd.setCursor(0, 20);
-    M5.Lcd.setTextSize(4);
-    M5.Lcd.printf("%9lu", transmitCount); // Total count
-
-    // Show messages/second
-    M5.Lcd.setTextSize(2);
-    M5.Lcd.setCursor(220, 25);
-    M5.Lcd.printf("%d/s", messagesPerSecond);
-
-    M5.Lcd.setTextSize(1); // Reset text size
+    const char* config = CAN_ID_FILE;
+    if (*name == '/') name++;
+    if (*config == '/') config++;
+    return strcasecmp(name, config) == 0;
 }
@@ -0,0 +1,244 @@
+#include "mdf4.h"
+#include "telemetry.h"
+
+// Block builder for the metadata area. Blocks are placed at 8 byte aligned
+// offsets in one RAM image; links may point forward and are set once the
+// target exists.
+class MdfImage
+{
+public:
+    uint8_t data[MDF_META_MAX];
+    size_t size = 64; // the identification block comes first
+
+    // Append a block, returns its offset
+    uint64_t block(const char* id, uint8_t links, size_t dataSize)
+    {
+        uint64_t at = size;
+        uint64_t length = 24 + links * 8 + dataSize;
+        memset(data + at, 0, length);
+        memcpy(data + at, id, 4);
+        memcpy(data + at + 8, &length, 8);
+        uint64_t count = links;
+        memcpy(data + at + 16, &count, 8);
+        size += (length + 7) & ~7;
+        return at;
+    }
+
+    void link(uint64_t from, uint8_t index, uint64_t to)
+    {
+        memcpy(data + from + 24 + index * 8, &to, 8);
+    }
+
+    uint8_t* body(uint64_t at, uint8_t links)
+    {
+        return data + at + 24 + links * 8;
+    }
+
+    uint64_t text(const char* id, const char* s)
+    {
+        size_t n = strlen(s) + 1;
+        uint64_t at = block(id, 0, (n + 7) & ~7);
+        memcpy(body(at, 0), s, n);
+        return at;
+    }
+};
+
+struct ChannelSpec
+{
+    const char* name;
+    uint8_t type;     // 0 fixed length, 2 master
+    uint8_t syncType; // 1 time
+    uint8_t dataType; // 0 uint LE, 4 float LE, 10 byte array
+    uint8_t bitOffset;
+    uint32_t byteOffset;
+    uint32_t bitCount;
+};
+
+// Record: 0 Timestamp f64 | 8 BusChannel | 9 ID u32, IDE in bit 31 |
+// 13 DLC | 14 DataLength | 15 DataBytes[8]
+static const ChannelSpec channels[] = {
+    {"Timestamp", 2, 1, 4, 0, 0, 64},
+    {"CAN_DataFrame", 0, 0, 10, 0, 8, 15 * 8},
+    {"CAN_DataFrame.BusChannel", 0, 0, 0, 0, 8, 8},
+    {"CAN_DataFrame.ID", 0, 0, 0, 0, 9, 29},
+    {"CAN_DataFrame.IDE", 0, 0, 0, 7, 12, 1},
+    {"CAN_DataFrame.DLC", 0, 0, 0, 0, 13, 4},
+    {"CAN_DataFrame.DataLength", 0, 0, 0, 0, 14, 8},
+    {"CAN_DataFrame.DataBytes", 0, 0, 10, 0, 15, 64},
+};
+static const uint8_t channelCount = sizeof(channels) / sizeof(channels[0]);
+
+bool Mf4Writer::openFile()
+{
+    file = openNextLogFile("can_", ".mf4");
+    if (!file) return false;
+
+    static MdfImage img;
+    img.size = 64;
+    memset(img.data, 0, 64);
+    memcpy(img.data, "UnFinMF 4.11    M5CANLOG", 24);
+    uint16_t version = 411;
+    memcpy(img.data + 28, &version, 2);
+    uint16_t unfinalized = 0x0005; // cycle counters and last DT length not updated
+    memcpy(img.data + 60, &unfinalized, 2);
+
+    uint64_t hd = img.block("##HD", MDF_HD_LINKS, 32);
+    uint64_t fhComment = img.text("##MD", "<FHcomment><TX>recorded</TX><tool_id>M5CanLogger</tool_id>"
+                                          "<tool_vendor>M5CanLogger</tool_vendor><tool_version>1.0</tool_version>"
+                                          "</FHcomment>");
+    uint64_t fh = img.block("##FH", MDF_FH_LINKS, 16);
+    img.link(fh, 1, fhComment);
+    img.link(hd, 1, fh);
+
+    uint64_t dg = img.block("##DG", MDF_DG_LINKS, 8);
+    img.link(hd, 0, dg);
+
+    uint64_t cg = img.block("##CG", MDF_CG_LINKS, 32);
+    img.link(dg, 1, cg);
+    img.link(cg, 2, img.text("##TX", "CAN_DataFrame"));
+
+    uint64_t si = img.block("##SI", MDF_SI_LINKS, 8);
+    img.link(si, 0, img.text("##TX", "CAN"));
+    uint8_t* siBody = img.body(si, MDF_SI_LINKS);
+    siBody[0] = 2; // bus
+    siBody[1] = 2; // CAN
+    img.link(cg, 3, si);
+
+    uint8_t* cgBody = img.body(cg, MDF_CG_LINKS);
+    uint16_t cgFlags = 0x0002 | 0x0004; // bus event, plain bus event
+    memcpy(cgBody + 16, &cgFlags, 2);
+    uint16_t pathSeparator = '.'; // CAN_DataFrame.ID
+    memcpy(cgBody + 18, &pathSeparator, 2);
+    uint32_t dataBytes = MDF_RECORD_SIZE;
+    memcpy(cgBody + 24, &dataBytes, 4);
+    cycleOffset = cg + 24 + MDF_CG_LINKS * 8 + 8;
+
+    // Channels: Timestamp -> CAN_DataFrame, whose composition is the chain
+    // of its member signals
+    uint64_t previous = 0;
+    for (uint8_t i = 0; i < channelCount; i++)
+    {
+        const ChannelSpec& c = channels[i];
+        uint64_t cn = img.block("##CN", MDF_CN_LINKS, 72);
+        img.link(cn, 2, img.text("##TX", c.name));
+        img.link(cn, 3, si);
+
+        uint8_t* b = img.body(cn, MDF_CN_LINKS);
+        b[0] = c.type;
+        b[1] = c.syncType;
+        b[2] = c.dataType;
+        b[3] = c.bitOffset;
+        memcpy(b + 4, &c.byteOffset, 4);
+        memcpy(b + 8, &c.bitCount, 4);
+
+        if (i == 0)
+            img.link(cg, 1, cn);
+        else if (i == 1 || i == 2)
+            img.link(previous, i == 1 ? 0 : 1, cn); // next of Timestamp, composition of CAN_DataFrame
+        else
+            img.link(previous, 0, cn);
+        previous = cn;
+    }
+
+    // Pad so that the DT payload starts on a sector boundary
+    dataOffset = ((img.size + 24 + 511) & ~(size_t)511) - 24;
+    if (dataOffset + 24 > MDF_META_MAX)
+    {
+        file.close();
+        return false;
+    }
+    memset(img.data + img.size, 0, dataOffset - img.size);
+    img.size = dataOffset;
+    uint64_t dt = img.block("##DT", 0, 0);
+    img.link(dg, 2, dt);
+
+    used = 0;
+    records = 0;
+    file.write(img.data, img.size);
+    return true;
+}
+
+bool Mf4Writer::begin()
+{
+    return openFile();
+}
+
+void Mf4Writer::write(const CanFrame& frame)
+{
+    // The next file could not be opened
+    if (!file)
+    {
+        lost++;
+        return;
+    }
+    if (frame.flags & (CAN_FRAME_RTR | CAN_FRAME_ERR))
+    {
+        skipped++;
+        return;
+    }
+
+    uint8_t record[MDF_RECORD_SIZE];
+    double seconds = frame.timestampUs * 1e-6;
+    memcpy(record, &seconds, 8);
+    record[8] = 1; // BusChannel
+    uint32_t id = frame.id | ((frame.flags & CAN_FRAME_EXT) ? 0x80000000UL : 0);
+    memcpy(record + 9, &id, 4);
+    record[13] = frame.len;
+    record[14] = frame.len;
+    memcpy(record + 15, frame.data, 8);
+    if (frame.len < 8) memset(record + 15 + frame.len, 0, 8 - frame.len);
+
+    size_t room = BUFFER_SIZE - used;
+    if (room <= MDF_RECORD_SIZE)
+    {
+        memcpy(buffer + used, record, room);
+        file.write((const uint8_t*)buffer, BUFFER_SIZE);
+        used = MDF_RECORD_SIZE - room;
+        memcpy(buffer, record + room, used);
+    }
+    else
+    {
+        memcpy(buffer + used, record, MDF_RECORD_SIZE);
+        used += MDF_RECORD_SIZE;
+    }
+    records++;
+
+    if (records * MDF_RECORD_SIZE >= (uint64_t)MDF_ROTATE_MB * 1024 * 1024)
+    {
+        finalize();
+        if (!openFile()) telemetryEvent(EVENT_MF4, MF4_ROTATE_FAILED, 0);
+    }
+}
+
+void Mf4Writer::flush()
+{
+    if (!file) return;
+    syncSectorTail(file, buffer, used);
+}
+
+void Mf4Writer::finalize()
+{
+    if (!file) return;
+    if (used > 0) file.write((const uint8_t*)buffer, used);
+    used = 0;
+
+    uint64_t length = 24 + records * MDF_RECORD_SIZE;
+    file.seek(dataOffset + 8);
+    file.write((const uint8_t*)&length, 8);
+    file.seek(cycleOffset);
+    file.write((const uint8_t*)&records, 8);
+    file.seek(0);
+    file.write((const uint8_t*)"MDF     ", 8);
+    uint16_t unfinalized = 0;
+    file.seek(60);
+    file.write((const uint8_t*)&unfinalized, 2);
+    file.close();
+
+    if (skipped) telemetryEvent(EVENT_MF4, MF4_SKIPPED, skipped);
+}
+
+void Mf4Writer::end()
+{
+    finalize();
+    if (lost) telemetryEvent(EVENT_MF4, MF4_LOST, lost);
+}
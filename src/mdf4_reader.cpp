@@ -0,0 +1,60 @@
+#include "mdf4.h"
+
+static_assert(MDF_META_MAX <= BLOCK_BUFFER_CAPACITY, "the MF4 metadata must fit the block buffer");
+
+static uint64_t linkAt(const char* image, uint64_t block, uint8_t index)
+{
+    uint64_t link;
+    memcpy(&link, image + block + 24 + index * 8, 8);
+    return link;
+}
+
+bool Mf4Reader::begin()
+{
+    // All metadata of our files precedes the data block and fits the buffer
+    size_t avail = buffer->ensure(MDF_META_MAX);
+    const char* image = buffer->pos;
+    if (avail < 64 + 24 + MDF_HD_LINKS * 8) return false;
+    bool finalized = memcmp(image, "MDF     ", 8) == 0;
+    if (!finalized && memcmp(image, "UnFinMF ", 8) != 0) return false;
+
+    uint64_t dg = linkAt(image, 64, 0);
+    if (dg == 0 || dg + 24 + MDF_DG_LINKS * 8 + 8 > avail) return false;
+    uint64_t cg = linkAt(image, dg, 1);
+    uint64_t dt = linkAt(image, dg, 2);
+    if (cg == 0 || cg + 24 + MDF_CG_LINKS * 8 + 32 > avail || dt == 0 || dt + 24 > avail) return false;
+
+    uint32_t dataBytes;
+    memcpy(&dataBytes, image + cg + 24 + MDF_CG_LINKS * 8 + 24, 4);
+    if (image[dg + 24 + MDF_DG_LINKS * 8] != 0 || dataBytes != MDF_RECORD_SIZE || memcmp(image + dt, "##DT", 4) != 0)
+    {
+        READER_EVENT(READER_FOREIGN_MF4, 0);
+        return false;
+    }
+
+    // The length of the last data block is only known once finalized
+    uint64_t length;
+    memcpy(&length, image + dt + 8, 8);
+    remaining = finalized ? (length - 24) / MDF_RECORD_SIZE : UINT64_MAX;
+    buffer->pos += dt + 24;
+    return true;
+}
+
+bool Mf4Reader::next(CanFrame& frame)
+{
+    if (remaining == 0 || buffer->ensure(MDF_RECORD_SIZE) < MDF_RECORD_SIZE) return false;
+    remaining--;
+
+    const char* record = buffer->pos;
+    buffer->pos += MDF_RECORD_SIZE;
+    double seconds;
+    uint32_t id;
+    memcpy(&seconds, record, 8);
+    memcpy(&id, record + 9, 4);
+    frame.timestampUs = (int64_t)(seconds * 1e6 + 0.5);
+    frame.id = id & 0x1FFFFFFFUL;
+    frame.flags = (id & 0x80000000UL) ? CAN_FRAME_EXT : 0;
+    frame.len = record[14] > 8 ? 8 : record[14];
+    memcpy(frame.data, record + 15, 8);
+    return true;
+}
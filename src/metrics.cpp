@@ -0,0 +1,102 @@
+#include <string.h>
+#include "metrics.h"
+#ifdef ARDUINO
+#include "serial_commands.h"
+#endif
+
+MetricSlot metricSlots[METRIC_CORES] = {};
+alignas(METRIC_ALIGN) volatile uint32_t metricGauges[METRIC_GAUGES] = {};
+
+// Slot values already in the totals. Readers on both cores fold, the lock
+// keeps two of them from adding the same updates.
+static uint32_t folded[METRIC_CORES][METRIC_COUNTERS];
+static uint64_t totals[METRIC_COUNTERS];
+
+#ifdef ARDUINO
+static portMUX_TYPE foldLock = portMUX_INITIALIZER_UNLOCKED;
+#define FOLD_LOCK() portENTER_CRITICAL(&foldLock)
+#define FOLD_UNLOCK() portEXIT_CRITICAL(&foldLock)
+#else
+#define FOLD_LOCK()
+#define FOLD_UNLOCK()
+#endif
+
+uint64_t metricCount(MetricCounter counter)
+{
+    FOLD_LOCK();
+    for (uint8_t c = 0; c < METRIC_CORES; c++)
+    {
+        uint32_t now = metricSlots[c].counters[counter];
+        totals[counter] += (uint32_t)(now - folded[c][counter]);
+        folded[c][counter] = now;
+    }
+    uint64_t total = totals[counter];
+    FOLD_UNLOCK();
+    return total;
+}
+
+void metricReset()
+{
+    FOLD_LOCK();
+    memset(metricSlots, 0, sizeof(metricSlots));
+    memset(folded, 0, sizeof(folded));
+    memset(totals, 0, sizeof(totals));
+    FOLD_UNLOCK();
+}
+
+void metricHistogram(MetricHistogram histogram, LogHistogram& out)
+{
+    memset(&out, 0, sizeof(out));
+    for (uint8_t c = 0; c < METRIC_CORES; c++)
+    {
+        const LogHistogram& h = metricSlots[c].histograms[histogram];
+        if (h.count == 0) continue;
+        if (out.count == 0 || h.min < out.min) out.min = h.min;
+        if (h.max > out.max) out.max = h.max;
+        out.count += h.count;
+        out.sum += h.sum;
+        for (uint8_t b = 0; b < LOG_HISTOGRAM_BUCKETS; b++) out.buckets[b] += h.buckets[b];
+    }
+}
+
+// The host build has no serial port
+#ifdef ARDUINO
+
+static const char* const counterNames[METRIC_COUNTERS] = {
+    "received", "dropped", "filtered", "unchanged", "transmitted", "late", "early",
+    "timing error sum us", "timing error count", "lz4 blocks", "lz4 in bytes",
+    "lz4 out bytes", "lz4 micros", "events dropped", "reanchors"};
+static const char* const gaugeNames[METRIC_GAUGES] = {
+    "heap free", "heap largest", "heap min free", "psram free", "psram largest",
+    "psram min free", "stack free min", "cpu0 permille", "cpu1 permille"};
+static const char* const histogramNames[METRIC_HISTOGRAMS] = {"schedule deviation us"};
+
+static void dumpMetrics(const char* args)
+{
+    for (uint8_t i = 0; i < METRIC_COUNTERS; i++)
+    {
+        Serial.printf("%-22s %10llu\n", counterNames[i], (unsigned long long)metricCount((MetricCounter)i));
+    }
+    for (uint8_t i = 0; i < METRIC_GAUGES; i++)
+    {
+        Serial.printf("%-22s %10lu\n", gaugeNames[i], (unsigned long)metricGauge((MetricGauge)i));
+    }
+    LogHistogram h;
+    for (uint8_t i = 0; i < METRIC_HISTOGRAMS; i++)
+    {
+        metricHistogram((MetricHistogram)i, h);
+        Serial.printf("%-22s %10lu p50 %lu p99 %lu p99.9 %lu max %lu\n", histogramNames[i],
+                      (unsigned long)h.count,
+                      (unsigned long)h.quantile(500),
+                      (unsigned long)h.quantile(990),
+                      (unsigned long)h.quantile(999),
+                      (unsigned long)h.max);
+    }
+}
+
+void beginMetrics()
+{
+    registerCommand("metrics", "counters, gauges and histograms", dumpMetrics);
+}
+
+#endif
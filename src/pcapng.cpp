@@ -0,0 +1,153 @@
+#include <esp_timer.h>
+#include "pcapng.h"
+#include "metrics.h"
+
+#define EPB_SIZE (28 + SOCKETCAN_FRAME_SIZE + 4)
+
+static inline uint8_t* put32(uint8_t* p, uint32_t v)
+{
+    memcpy(p, &v, 4);
+    return p + 4;
+}
+
+static inline uint8_t* put16(uint8_t* p, uint16_t v)
+{
+    memcpy(p, &v, 2);
+    return p + 2;
+}
+
+static inline uint8_t* putOption64(uint8_t* p, uint16_t code, uint64_t v)
+{
+    p = put16(p, code);
+    p = put16(p, 8);
+    memcpy(p, &v, 8);
+    return p + 8;
+}
+
+// ==================== pcapng Writer ====================
+
+void PcapngWriter::append(const uint8_t* data, size_t n)
+{
+    while (n > 0)
+    {
+        size_t chunk = min(n, BUFFER_SIZE - used);
+        memcpy(buffer + used, data, chunk);
+        used += chunk;
+        data += chunk;
+        n -= chunk;
+        if (used == BUFFER_SIZE)
+        {
+            file.write((const uint8_t*)buffer, BUFFER_SIZE);
+            used = 0;
+        }
+    }
+}
+
+bool PcapngWriter::begin()
+{
+    file = openNextLogFile("can_", ".pcapng");
+    if (!file) return false;
+    used = 0;
+
+    uint8_t shb[28];
+    uint8_t* p = put32(shb, PCAPNG_SHB);
+    p = put32(p, sizeof(shb));
+    p = put32(p, PCAPNG_BYTE_ORDER);
+    p = put16(p, 1);
+    p = put16(p, 0);
+    p = put32(p, 0xFFFFFFFF); // section length unknown
+    p = put32(p, 0xFFFFFFFF);
+    put32(p, sizeof(shb));
+    append(shb, sizeof(shb));
+
+    // Microsecond timestamps are the pcapng default, if_tsresol is spelled
+    // out anyway for readers that do not assume it
+    uint8_t idb[40];
+    p = put32(idb, PCAPNG_IDB);
+    p = put32(p, sizeof(idb));
+    p = put16(p, LINKTYPE_CAN_SOCKETCAN);
+    p = put16(p, 0);
+    p = put32(p, SOCKETCAN_FRAME_SIZE);
+    p = put16(p, PCAPNG_OPT_IF_NAME);
+    p = put16(p, 4);
+    memcpy(p, "can0", 4);
+    p += 4;
+    p = put16(p, PCAPNG_OPT_IF_TSRESOL);
+    p = put16(p, 1);
+    *p++ = 6;
+    *p++ = 0;
+    *p++ = 0;
+    *p++ = 0;
+    p = put32(p, PCAPNG_OPT_END);
+    put32(p, sizeof(idb));
+    append(idb, sizeof(idb));
+    return true;
+}
+
+void PcapngWriter::write(const CanFrame& frame)
+{
+    uint8_t epb[EPB_SIZE];
+    uint64_t ts = frame.timestampUs;
+    lastTimestamp = frame.timestampUs;
+
+    uint8_t* p = put32(epb, PCAPNG_EPB);
+    p = put32(p, EPB_SIZE);
+    p = put32(p, 0); // interface
+    p = put32(p, ts >> 32);
+    p = put32(p, (uint32_t)ts);
+    p = put32(p, SOCKETCAN_FRAME_SIZE);
+    p = put32(p, SOCKETCAN_FRAME_SIZE);
+
+    // struct can_frame, can_id in network byte order
+    uint32_t canId = frame.id;
+    if (frame.flags & CAN_FRAME_EXT) canId |= 0x80000000UL;
+    if (frame.flags & CAN_FRAME_RTR) canId |= 0x40000000UL;
+    if (frame.flags & CAN_FRAME_ERR) canId |= 0x20000000UL;
+    *p++ = canId >> 24;
+    *p++ = canId >> 16;
+    *p++ = canId >> 8;
+    *p++ = canId;
+    *p++ = frame.len;
+    *p++ = 0;
+    *p++ = 0;
+    *p++ = 0;
+    memcpy(p, frame.data, 8);
+    if (frame.len < 8) memset(p + frame.len, 0, 8 - frame.len);
+    p += 8;
+    put32(p, EPB_SIZE);
+
+    append(epb, EPB_SIZE);
+}
+
+void PcapngWriter::writeStatistics()
+{
+    uint8_t isb[20 + 3 * 12 + 4 + 4];
+    uint64_t ts = lastTimestamp ? lastTimestamp : esp_timer_get_time();
+
+    uint8_t* p = put32(isb, PCAPNG_ISB);
+    p = put32(p, sizeof(isb));
+    p = put32(p, 0);
+    p = put32(p, ts >> 32);
+    p = put32(p, (uint32_t)ts);
+    uint64_t received = metricCount(METRIC_RECEIVED);
+    p = putOption64(p, PCAPNG_OPT_ISB_IFRECV, received + metricCount(METRIC_FILTERED));
+    p = putOption64(p, PCAPNG_OPT_ISB_FILTERACCEPT, received);
+    p = putOption64(p, PCAPNG_OPT_ISB_OSDROP, metricCount(METRIC_DROPPED));
+    p = put32(p, PCAPNG_OPT_END);
+    put32(p, sizeof(isb));
+    append(isb, sizeof(isb));
+}
+
+void PcapngWriter::flush()
+{
+    writeStatistics();
+    syncSectorTail(file, buffer, used);
+}
+
+void PcapngWriter::end()
+{
+    writeStatistics();
+    if (used > 0) file.write((const uint8_t*)buffer, used);
+    used = 0;
+    file.close();
+}
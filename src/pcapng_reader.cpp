@@ -0,0 +1,138 @@
+#include "pcapng.h"
+
+uint32_t PcapngReader::get32(const uint8_t* p) const
+{
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return swapped ? __builtin_bswap32(v) : v;
+}
+
+uint16_t PcapngReader::get16(const uint8_t* p) const
+{
+    uint16_t v;
+    memcpy(&v, p, 2);
+    return swapped ? __builtin_bswap16(v) : v;
+}
+
+void PcapngReader::skip(size_t n)
+{
+    while (n > 0)
+    {
+        size_t avail = buffer->end - buffer->pos;
+        if (avail == 0 && !buffer->fill()) return;
+        size_t chunk = std::min(n, (size_t)(buffer->end - buffer->pos));
+        buffer->pos += chunk;
+        n -= chunk;
+    }
+}
+
+void PcapngReader::readInterface(const uint8_t* body, size_t n)
+{
+    if (interfaceCount >= PCAPNG_MAX_INTERFACES || n < 8) return;
+    Interface& itf = interfaces[interfaceCount++];
+    itf.socketcan = get16(body) == LINKTYPE_CAN_SOCKETCAN;
+    itf.tsresol = 6;
+    itf.tsoffset = 0;
+
+    const uint8_t* p = body + 8;
+    const uint8_t* end = body + n;
+    while (end - p >= 4)
+    {
+        uint16_t code = get16(p);
+        uint16_t len = get16(p + 2);
+        p += 4;
+        if (code == PCAPNG_OPT_END || end - p < len) break;
+        if (code == PCAPNG_OPT_IF_TSRESOL && len >= 1) itf.tsresol = p[0];
+        if (code == PCAPNG_OPT_IF_TSOFFSET && len >= 8)
+        {
+            uint64_t v = (uint64_t)get32(p + (swapped ? 0 : 4)) << 32 | get32(p + (swapped ? 4 : 0));
+            itf.tsoffset = (int64_t)v;
+        }
+        p += (len + 3) & ~3;
+    }
+
+    // Base 2 resolutions finer than 2^-63 s do not fit the shift in
+    // toMicros(); the frames of such an interface are skipped
+    if ((itf.tsresol & 0x80) && (itf.tsresol & 0x7F) >= 64) itf.socketcan = false;
+}
+
+int64_t PcapngReader::toMicros(const Interface& itf, uint64_t ts) const
+{
+    int64_t us;
+    uint8_t n = itf.tsresol & 0x7F;
+    if (itf.tsresol & 0x80)
+    {
+        us = (int64_t)(ts >> n) * 1000000 + (int64_t)((double)(ts & ((1ULL << n) - 1)) * 1e6 / (double)(1ULL << n));
+    }
+    else if (n <= 6)
+    {
+        us = (int64_t)ts;
+        for (uint8_t i = n; i < 6; i++) us *= 10;
+    }
+    else
+    {
+        us = (int64_t)ts;
+        for (uint8_t i = 6; i < n; i++) us /= 10;
+    }
+    return us + itf.tsoffset * 1000000;
+}
+
+bool PcapngReader::next(CanFrame& frame)
+{
+    // Interface description bodies with a few options, or a packet block
+    // with a SocketCAN frame, fit in one look
+    const size_t look = 64;
+
+    while (true)
+    {
+        size_t avail = buffer->ensure(look);
+        if (avail < 12) return false;
+        const uint8_t* p = (const uint8_t*)buffer->pos;
+
+        // The section header type reads the same in both byte orders and
+        // sets the order for everything up to the next one
+        uint32_t type;
+        memcpy(&type, p, 4);
+        if (type == PCAPNG_SHB)
+        {
+            uint32_t magic;
+            memcpy(&magic, p + 8, 4);
+            swapped = magic != PCAPNG_BYTE_ORDER;
+            interfaceCount = 0; // interface IDs restart per section
+        }
+        type = get32(p);
+
+        uint32_t total = get32(p + 4);
+        if (total < 12 || (total & 3)) return false;
+        size_t bodyLen = std::min((size_t)total - 12, avail - 8);
+        const uint8_t* body = p + 8;
+
+        if (type == PCAPNG_IDB)
+        {
+            readInterface(body, bodyLen);
+        }
+        else if (type == PCAPNG_EPB)
+        {
+            uint32_t itf = get32(body);
+            uint32_t captured = get32(body + 12);
+            if (itf < interfaceCount && interfaces[itf].socketcan && captured >= 8 && bodyLen >= 20 + 8 + 8)
+            {
+                uint64_t ts = (uint64_t)get32(body + 4) << 32 | get32(body + 8);
+                const uint8_t* can = body + 20;
+                uint32_t canId = (uint32_t)can[0] << 24 | can[1] << 16 | can[2] << 8 | can[3];
+
+                frame.timestampUs = toMicros(interfaces[itf], ts);
+                frame.flags = 0;
+                if (canId & 0x80000000UL) frame.flags |= CAN_FRAME_EXT;
+                if (canId & 0x40000000UL) frame.flags |= CAN_FRAME_RTR;
+                if (canId & 0x20000000UL) frame.flags |= CAN_FRAME_ERR;
+                frame.id = canId & ((frame.flags & (CAN_FRAME_EXT | CAN_FRAME_ERR)) ? 0x1FFFFFFFUL : 0x7FFUL);
+                frame.len = can[4] > 8 ? 8 : can[4];
+                memcpy(frame.data, can + 8, 8);
+                skip(total);
+                return true;
+            }
+        }
+        skip(total);
+    }
+}
@@ -0,0 +1,206 @@
+#include <M5Unified.h>
+#include <esp_timer.h>
+#include "recorder.h"
+#include "can_bus.h"
+#include "config.h"
+#include "log_writer.h"
+#include "flight_recorder.h"
+#include "lz4_writer.h"
+#include "delta_log.h"
+#include "pcapng.h"
+#include "mdf4.h"
+#include "trigger_capture.h"
+#include "change_filter.h"
+#include "can_id_filter.h"
+#include "top_talkers.h"
+#include "trace_buffer.h"
+#include "metrics.h"
+#include "telemetry.h"
+
+
+static QueueHandle_t frameQueue = NULL;
+static TaskHandle_t receiveTaskHandle = NULL;
+static LogWriter* logWriter = NULL;
+static volatile bool stopRequested = false;
+static volatile bool writerStopped = false;
+
+void CANReceiveTask(void* pvParameters);
+void LogWriterTask(void* pvParameters);
+
+static void IRAM_ATTR canInterrupt()
+{
+    TRACE(TRACE_ISR, 0);
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(receiveTaskHandle, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+bool startRecorder()
+{
+    SD.mkdir(LOG_DIR);
+
+#if LOG_FORMAT == LOG_FORMAT_FLIGHT
+    logWriter = new FlightRecorder();
+#elif LOG_FORMAT == LOG_FORMAT_LZ4
+    logWriter = new Lz4CandumpWriter();
+#elif LOG_FORMAT == LOG_FORMAT_DELTA
+    logWriter = new DeltaWriter();
+#elif LOG_FORMAT == LOG_FORMAT_PCAPNG
+    logWriter = new PcapngWriter();
+#elif LOG_FORMAT == LOG_FORMAT_MF4
+    logWriter = new Mf4Writer();
+#else
+    logWriter = new CandumpWriter();
+#endif
+#if LOG_CHANGE_ONLY
+    logWriter = new ChangeFilter(logWriter);
+#endif
+#if LOG_TRIGGER
+    logWriter = new TriggerCapture(logWriter);
+#endif
+    if (!logWriter->begin())
+    {
+        telemetryEvent(EVENT_RECORDING, RECORDING_OPEN_FAILED, 0);
+        return false;
+    }
+
+    frameQueue = xQueueCreate(QUEUE_SIZE, sizeof(CanFrame));
+    if (!frameQueue) return false;
+
+    xTaskCreatePinnedToCore(LogWriterTask, "LogWriter", 8192, NULL, 1, NULL, 0);
+    xTaskCreatePinnedToCore(CANReceiveTask, "CANReceive", 4096, NULL, 2, &receiveTaskHandle, 1);
+    attachInterrupt(digitalPinToInterrupt(CAN0_INT), canInterrupt, FALLING);
+    return true;
+}
+
+void stopRecorder()
+{
+    if (!logWriter) return;
+    stopRequested = true;
+    for (int i = 0; i < 200 && !writerStopped; i++)
+    {
+        delay(10);
+    }
+}
+
+// ==================== CAN Receive Task ====================
+
+static void queueFrame(const CanFrame& frame)
+{
+    metricAdd(METRIC_RECEIVED);
+    if (xQueueSend(frameQueue, &frame, 0) != pdTRUE)
+    {
+        metricAdd(METRIC_DROPPED);
+    }
+}
+
+// Translate a change of the MCP2515 error flags (EFLG) into a SocketCAN
+// style error frame, so triggers and logs see controller state changes
+static void pollControllerErrors()
+{
+    static uint8_t lastFlags = 0;
+    uint8_t eflg = CAN0.getError();
+    if (eflg == lastFlags) return;
+    lastFlags = eflg;
+    if (!eflg) return;
+
+    CanFrame frame = {};
+    frame.timestampUs = esp_timer_get_time();
+    frame.flags = CAN_FRAME_ERR;
+    frame.len = 8;
+    frame.id = 0x200; // CAN_ERR_CNT, counters in data[6..7]
+    if (eflg & 0x20) frame.id |= 0x40; // CAN_ERR_BUSOFF
+    if (eflg & 0xDE)
+    {
+        frame.id |= 0x04; // CAN_ERR_CRTL
+        if (eflg & 0xC0) frame.data[1] |= 0x01; // RX0OVR/RX1OVR
+        if (eflg & 0x02) frame.data[1] |= 0x04; // RXWAR
+        if (eflg & 0x04) frame.data[1] |= 0x08; // TXWAR
+        if (eflg & 0x08) frame.data[1] |= 0x10; // RXEP
+        if (eflg & 0x10) frame.data[1] |= 0x20; // TXEP
+    }
+    frame.data[6] = CAN0.errorCountTX();
+    frame.data[7] = CAN0.errorCountRX();
+    queueFrame(frame);
+}
+
+void CANReceiveTask(void* pvParameters)
+{
+    CanFrame frame;
+    unsigned long id;
+    uint8_t len;
+    uint32_t lastErrorPoll = 0;
+
+    while (true)
+    {
+        // INT stays low while a receive buffer is full, the timeout covers an
+        // edge that fell while the buffers were still being drained
+        TRACE(TRACE_TASK_WAIT, TRACE_RECEIVE);
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+        TRACE(TRACE_TASK_RUN, TRACE_RECEIVE);
+
+        if (millis() - lastErrorPoll >= 100)
+        {
+            lastErrorPoll = millis();
+            pollControllerErrors();
+        }
+
+        while (digitalRead(CAN0_INT) == LOW)
+        {
+            if (CAN0.readMsgBuf(&id, &len, frame.data) != CAN_OK) break;
+            frame.timestampUs = esp_timer_get_time();
+            frameFromMcpId(id, frame);
+            frame.len = len > 8 ? 8 : len;
+
+            // The acceptance filters are a superset of the ID list, drop
+            // what got through by mask only
+            if (!idFilter.accepts(frame.id, frame.flags & CAN_FRAME_EXT))
+            {
+                metricAdd(METRIC_FILTERED);
+                continue;
+            }
+            topTalkers.count(frame);
+            queueFrame(frame);
+        }
+    }
+}
+
+// ==================== Log Writer Task ====================
+
+void LogWriterTask(void* pvParameters)
+{
+    CanFrame frame;
+    uint32_t lastSync = millis();
+
+    while (!stopRequested)
+    {
+        // Only an empty queue blocks, the trace records no switch per frame
+        bool received = xQueueReceive(frameQueue, &frame, 0) == pdTRUE;
+        if (!received)
+        {
+            TRACE(TRACE_TASK_WAIT, TRACE_WRITER);
+            received = xQueueReceive(frameQueue, &frame, pdMS_TO_TICKS(100)) == pdTRUE;
+            TRACE(TRACE_TASK_RUN, TRACE_WRITER);
+        }
+        if (received)
+        {
+            logWriter->write(frame);
+        }
+        if (millis() - lastSync >= LOG_SYNC_MS)
+        {
+            lastSync = millis();
+            TRACE(TRACE_SD_SYNC_BEGIN, 0);
+            logWriter->flush();
+            TRACE(TRACE_SD_SYNC_END, 0);
+        }
+    }
+
+    while (xQueueReceive(frameQueue, &frame, 0) == pdTRUE)
+    {
+        logWriter->write(frame);
+    }
+    logWriter->end();
+    writerStopped = true;
+    telemetryEvent(EVENT_RECORDING, RECORDING_STOPPED, 0);
+    vTaskDelete(NULL);
+}
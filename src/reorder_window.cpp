@@ -0,0 +1,91 @@
+#include "reorder_window.h"
+#include "metrics.h"
+
+bool ReorderWindow::earlier(uint16_t a, uint16_t b) const
+{
+    const CanFrame& x = slots[heap[a]];
+    const CanFrame& y = slots[heap[b]];
+    if (x.timestampUs != y.timestampUs) return x.timestampUs < y.timestampUs;
+    return (int32_t)(order[heap[a]] - order[heap[b]]) < 0;
+}
+
+void ReorderWindow::siftUp(uint16_t i)
+{
+    while (i > 0)
+    {
+        uint16_t parent = (i - 1) / 2;
+        if (!earlier(i, parent)) break;
+        uint16_t t = heap[i];
+        heap[i] = heap[parent];
+        heap[parent] = t;
+        i = parent;
+    }
+}
+
+void ReorderWindow::siftDown(uint16_t i)
+{
+    while (true)
+    {
+        uint16_t smallest = i;
+        uint16_t left = 2 * i + 1;
+        uint16_t right = left + 1;
+        if (left < count && earlier(left, smallest)) smallest = left;
+        if (right < count && earlier(right, smallest)) smallest = right;
+        if (smallest == i) break;
+        uint16_t t = heap[i];
+        heap[i] = heap[smallest];
+        heap[smallest] = t;
+        i = smallest;
+    }
+}
+
+void ReorderWindow::release(const CanFrame& frame, CanFrame& out)
+{
+    if (frame.timestampUs < lastReleased)
+        metricAdd(METRIC_LATE);
+    else
+        lastReleased = frame.timestampUs;
+    out = frame;
+}
+
+bool ReorderWindow::push(const CanFrame& frame, CanFrame& out)
+{
+    if (REORDER_DEPTH == 0)
+    {
+        release(frame, out);
+        return true;
+    }
+
+    if (count < REORDER_DEPTH)
+    {
+        slots[count] = frame;
+        order[count] = sequence++;
+        heap[count] = count;
+        siftUp(count++);
+        return false;
+    }
+
+    // Window full: the new frame goes out directly if it is older than
+    // everything held, otherwise it takes the place of the oldest frame
+    uint16_t root = heap[0];
+    if (frame.timestampUs < slots[root].timestampUs)
+    {
+        release(frame, out);
+        return true;
+    }
+    release(slots[root], out);
+    slots[root] = frame;
+    order[root] = sequence++;
+    siftDown(0);
+    return true;
+}
+
+bool ReorderWindow::pop(CanFrame& out)
+{
+    if (count == 0) return false;
+    uint16_t root = heap[0];
+    release(slots[root], out);
+    heap[0] = heap[--count];
+    siftDown(0);
+    return true;
+}
@@ -0,0 +1,199 @@
+#include <M5Unified.h>
+#include <esp_timer.h>
+#include "replay.h"
+#include "can_bus.h"
+#include "can_tx.h"
+#include "can_frame.h"
+#include "can_id_filter.h"
+#include "config.h"
+#include "frame_reader.h"
+#include "log_source.h"
+#include "reorder_window.h"
+#include "replay_engine.h"
+#include "top_talkers.h"
+#include "stage_profiler.h"
+#include "trace_buffer.h"
+#include "telemetry.h"
+#include "metrics.h"
+
+static File* replayFile = NULL;
+static char replayName[64];
+static LogSource* source = NULL;
+static FrameReader* reader = NULL;
+static QueueHandle_t replayQueue = NULL;
+static volatile bool readerDone = false;
+
+void LogReaderTask(void* pvParameters);
+void CANTransmitTask(void* pvParameters);
+
+bool startReplay(File& file)
+{
+    replayFile = &file;
+    strlcpy(replayName, file.name(), sizeof(replayName));
+    source = openLogSource(file);
+    if (!source)
+    {
+        telemetryEvent(EVENT_REPLAY, REPLAY_CANNOT_DECODE, 0);
+        return false;
+    }
+
+    reader = openFrameReader(source);
+    if (!reader)
+    {
+        telemetryEvent(EVENT_REPLAY, REPLAY_CANNOT_PARSE, 0);
+        return false;
+    }
+
+    replayQueue = xQueueCreate(QUEUE_SIZE, sizeof(CanFrame));
+    if (!replayQueue) return false;
+
+    telemetryEvent(EVENT_REPLAY, REPLAY_STARTED, 0);
+    xTaskCreatePinnedToCore(LogReaderTask, "LogReader", 8192, NULL, 1, NULL, 0);
+    xTaskCreatePinnedToCore(CANTransmitTask, "CANTransmit", 8192, NULL, 1, NULL, 1);
+    return true;
+}
+
+// ==================== Log Reader Task ====================
+
+// Only a full queue blocks, the trace records no switch per frame
+static void sendFrame(const CanFrame& frame)
+{
+    if (xQueueSend(replayQueue, &frame, 0) == pdTRUE) return;
+    TRACE(TRACE_TASK_WAIT, TRACE_READER);
+    xQueueSend(replayQueue, &frame, portMAX_DELAY);
+    TRACE(TRACE_TASK_RUN, TRACE_READER);
+}
+
+void LogReaderTask(void* pvParameters)
+{
+    static ReorderWindow window;
+    CanFrame frame;
+    CanFrame ordered;
+    while (true)
+    {
+#if PROFILE_STAGES
+        // Parse time is the time in next() minus the reads it made
+        uint32_t readBefore = stageCycles(STAGE_READ);
+        STAGE_START(parseStart);
+        bool more = reader->next(frame);
+        recordStage(STAGE_PARSE, xthal_get_ccount() - parseStart - (stageCycles(STAGE_READ) - readBefore));
+#else
+        bool more = reader->next(frame);
+#endif
+        if (!more) break;
+
+        // Error frames in a log cannot be put back on the bus
+        if (frame.flags & CAN_FRAME_ERR) continue;
+
+        // Filtered frames never reach the transmit task, so its timing
+        // reference stays on the last frame actually sent
+        if (!idFilter.accepts(frame.id, frame.flags & CAN_FRAME_EXT))
+        {
+            metricAdd(METRIC_FILTERED);
+            continue;
+        }
+        if (window.push(frame, ordered)) sendFrame(ordered);
+    }
+    while (window.pop(ordered))
+    {
+        sendFrame(ordered);
+    }
+
+    delete reader;
+    delete source;
+    reader = NULL;
+    source = NULL;
+    replayFile->close();
+    readerDone = true;
+    vTaskDelete(NULL);
+}
+
+// ==================== CAN Transmit Task ====================
+
+static void writeTimingReport()
+{
+    LogHistogram deviation;
+    metricHistogram(HIST_SCHEDULE_DEVIATION, deviation);
+    char line[224];
+    snprintf(line, sizeof(line),
+             "%s: %lu frames, deviation from schedule p50 %lu us, p99 %lu us, p99.9 %lu us, max %lu us, early %llu, late %llu, reanchors %llu",
+             replayName,
+             (unsigned long)deviation.count,
+             (unsigned long)deviation.quantile(500),
+             (unsigned long)deviation.quantile(990),
+             (unsigned long)deviation.quantile(999),
+             (unsigned long)deviation.max,
+             (unsigned long long)metricCount(METRIC_EARLY),
+             (unsigned long long)metricCount(METRIC_LATE),
+             (unsigned long long)metricCount(METRIC_REANCHORS));
+
+    SD.mkdir(LOG_DIR);
+    File report = SD.open(REPLAY_REPORT_PATH, FILE_APPEND);
+    if (!report)
+    {
+        telemetryEvent(EVENT_REPLAY, REPLAY_NO_REPORT, 0);
+        return;
+    }
+    report.println(line);
+    report.close();
+}
+
+// MCP2515 transmit path
+class McpController : public CanController
+{
+public:
+    uint8_t transmit(const CanFrame& frame) override { return transmitFrame(frame); }
+};
+
+// esp_timer time, sleeps with vTaskDelay. That works in ticks, for log
+// playback ms resolution should be okay; the deviation histogram shows
+// what it costs.
+class TaskClock : public ReplayClock
+{
+public:
+    int64_t nowUs() override { return esp_timer_get_time(); }
+    void sleepUs(int64_t us) override
+    {
+        uint32_t delayMs = (uint32_t)(us / 1000);
+        if (delayMs == 0) return;
+        TRACE(TRACE_TASK_WAIT, TRACE_TRANSMIT);
+        vTaskDelay(pdMS_TO_TICKS(delayMs));
+        TRACE(TRACE_TASK_RUN, TRACE_TRANSMIT);
+    }
+};
+
+void CANTransmitTask(void* pvParameters)
+{
+    McpController controller;
+    TaskClock clock;
+    ReplayEngine engine(controller, clock);
+    CanFrame frame;
+
+    while (true)
+    {
+        if (xQueueReceive(replayQueue, &frame, 0) != pdTRUE)
+        {
+            TRACE(TRACE_TASK_WAIT, TRACE_TRANSMIT);
+            bool received = xQueueReceive(replayQueue, &frame, pdMS_TO_TICKS(100)) == pdTRUE;
+            TRACE(TRACE_TASK_RUN, TRACE_TRANSMIT);
+            if (!received)
+            {
+                if (readerDone) break;
+                continue;
+            }
+        }
+
+        uint8_t sndStat = engine.send(frame);
+        if (sndStat == CAN_OK)
+        {
+            topTalkers.count(frame);
+        }
+        else
+        {
+            telemetryEvent(EVENT_TX_ERROR, sndStat, (frame.flags & CAN_FRAME_EXT) ? frame.id | 0x80000000UL : frame.id);
+        }
+    }
+    telemetryEvent(EVENT_REPLAY, REPLAY_FINISHED, (uint32_t)metricCount(METRIC_TRANSMITTED));
+    writeTimingReport();
+    vTaskDelete(NULL);
+}
@@ -0,0 +1,65 @@
+#include "replay_engine.h"
+#include "metrics.h"
+#include "stage_profiler.h"
+
+void ReplayEngine::recordTiming(int64_t scheduledUs, int64_t loggedGap)
+{
+    metricAdd(METRIC_TRANSMITTED);
+    int64_t now = clock.nowUs();
+    int64_t deviation = now - scheduledUs;
+    if (deviation < 0)
+    {
+        metricAdd(METRIC_EARLY);
+        deviation = -deviation;
+    }
+    metricRecord(HIST_SCHEDULE_DEVIATION, deviation > UINT32_MAX ? UINT32_MAX : (uint32_t)deviation);
+    if (loggedGap >= 0 && lastSentUs >= 0)
+    {
+        int64_t error = (now - lastSentUs) - loggedGap;
+        metricAdd(METRIC_TIMING_ERROR_SUM_US, error < 0 ? -error : error);
+        metricAdd(METRIC_TIMING_ERROR_COUNT);
+    }
+    lastSentUs = now;
+}
+
+uint8_t ReplayEngine::send(const CanFrame& frame)
+{
+    if (lastTimestamp < 0) scheduleOffsetUs = clock.nowUs() - frame.timestampUs;
+    int64_t scheduledUs = frame.timestampUs + scheduleOffsetUs;
+    int64_t loggedGap = -1;
+    // A frame older than the last one was let through late by the reorder
+    // window; it goes out at once and leaves the time line as it is
+    if (lastTimestamp < 0 || frame.timestampUs >= lastTimestamp)
+    {
+        if (lastTimestamp >= 0) loggedGap = frame.timestampUs - lastTimestamp;
+        int64_t behindUs = clock.nowUs() - scheduledUs;
+        if (lastTimestamp >= 0 && REPLAY_MAX_BEHIND_US && behindUs > REPLAY_MAX_BEHIND_US)
+        {
+            scheduleOffsetUs += behindUs;
+            scheduledUs += behindUs;
+            metricAdd(METRIC_REANCHORS);
+        }
+
+        STAGE_START(waitStart);
+        int64_t waitUs = scheduledUs - clock.nowUs();
+        if (waitUs > 0) clock.sleepUs(waitUs);
+        STAGE_END(STAGE_WAIT, waitStart);
+        lastTimestamp = frame.timestampUs;
+    }
+
+    uint8_t status = CAN_FAIL;
+    for (uint8_t attempt = 0; attempt < REPLAY_TX_ATTEMPTS; attempt++)
+    {
+        status = can.transmit(frame);
+        if (status == CAN_OK)
+        {
+            recordTiming(scheduledUs, loggedGap);
+            break;
+        }
+        // Other errors are reported by the caller
+        if (status != CAN_GETTXBFTIMEOUT) break;
+        // Bus is full or no ACK, wait a bit
+        clock.sleepUs(REPLAY_BUSY_WAIT_US);
+    }
+    return status;
+}
@@ -0,0 +1,171 @@
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <esp_freertos_hooks.h>
+#include <esp_timer.h>
+#include "resource_monitor.h"
+#include "metrics.h"
+#include "telemetry.h"
+
+ResourceSnapshot resources = {};
+
+#define RESOURCE_IDLE_HOOKS !(configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS)
+
+#if RESOURCE_IDLE_HOOKS
+
+// ==================== Idle Hooks ====================
+// A hook that returns false keeps the idle loop spinning instead of waiting
+// for an interrupt, so while nothing else wants the core it runs again
+// within a few hundred cycles. A longer gap means a task or an interrupt
+// had the core and is left out of the idle time.
+
+#ifndef RESOURCE_IDLE_GAP_US
+#define RESOURCE_IDLE_GAP_US 10
+#endif
+
+static volatile uint32_t idleCycles[2] = {};
+static uint32_t lastIdlePass[2] = {};
+static uint32_t idleGapCycles = 0;
+static bool idleHooks = false;
+
+static bool countIdle()
+{
+    BaseType_t core = xPortGetCoreID();
+    uint32_t now = ESP.getCycleCount();
+    uint32_t gap = now - lastIdlePass[core];
+    if (gap < idleGapCycles) idleCycles[core] += gap;
+    lastIdlePass[core] = now;
+    return false;
+}
+
+// Load of each core since the last call, unknown on the first
+static void sampleIdleHooks(uint16_t coreLoad[2])
+{
+    static uint32_t previousIdle[2];
+    static int64_t previousUs = -1;
+    if (!idleHooks) return;
+
+    int64_t now = esp_timer_get_time();
+    uint64_t elapsed = (uint64_t)(now - previousUs) * ESP.getCpuFreqMHz();
+    for (uint8_t core = 0; core < 2; core++)
+    {
+        uint32_t idle = idleCycles[core];
+        if (previousUs >= 0 && elapsed)
+        {
+            uint32_t ran = idle - previousIdle[core];
+            coreLoad[core] = ran >= elapsed ? 0 : 1000 - (uint64_t)ran * 1000 / elapsed;
+        }
+        previousIdle[core] = idle;
+    }
+    previousUs = now;
+}
+
+void beginResourceMonitor()
+{
+    idleGapCycles = RESOURCE_IDLE_GAP_US * ESP.getCpuFreqMHz();
+    idleHooks = esp_register_freertos_idle_hook_for_cpu(countIdle, 0) == ESP_OK &&
+                esp_register_freertos_idle_hook_for_cpu(countIdle, 1) == ESP_OK;
+    if (!idleHooks) telemetryEvent(EVENT_UNAVAILABLE, FEATURE_CPU_LOAD, 0);
+}
+
+#else
+
+void beginResourceMonitor() {}
+
+#endif
+
+#if configUSE_TRACE_FACILITY
+
+// Run time of each task at the last sample, by task number
+struct RunTimeMark
+{
+    UBaseType_t number;
+    uint32_t runTime;
+};
+
+static void sampleTasks()
+{
+    static TaskStatus_t status[RESOURCE_MAX_TASKS];
+    static RunTimeMark previous[RESOURCE_MAX_TASKS];
+    static uint8_t previousCount = 0;
+    static uint32_t previousTotal = 0;
+
+    uint32_t total = 0;
+    UBaseType_t n = uxTaskGetSystemState(status, RESOURCE_MAX_TASKS, &total);
+    if (n == 0) return; // more tasks than RESOURCE_MAX_TASKS
+
+    // The run time counter counts per core, a task that ran the whole
+    // period on its core has total - previousTotal
+    uint32_t elapsed = total - previousTotal;
+    RunTimeMark current[RESOURCE_MAX_TASKS];
+    uint32_t stackFreeMin = UINT32_MAX;
+    uint16_t coreLoad[2] = {RESOURCE_UNKNOWN, RESOURCE_UNKNOWN};
+
+    for (UBaseType_t i = 0; i < n; i++)
+    {
+        const TaskStatus_t& s = status[i];
+        TaskResources& task = resources.tasks[i];
+        strlcpy(task.name, s.pcTaskName, sizeof(task.name));
+#if configTASKLIST_INCLUDE_COREID
+        task.core = s.xCoreID < 2 ? s.xCoreID : 0xFF;
+#else
+        task.core = 0xFF;
+#endif
+        // Stack sizes on the ESP32 are in bytes, so is the high-water mark
+        task.stackFreeMin = s.usStackHighWaterMark;
+        if (task.stackFreeMin < stackFreeMin) stackFreeMin = task.stackFreeMin;
+
+        task.cpuPermille = RESOURCE_UNKNOWN;
+        current[i] = {s.xTaskNumber, s.ulRunTimeCounter};
+#if configGENERATE_RUN_TIME_STATS
+        for (uint8_t j = 0; j < previousCount && elapsed; j++)
+        {
+            if (previous[j].number != s.xTaskNumber) continue;
+            uint32_t ran = s.ulRunTimeCounter - previous[j].runTime;
+            task.cpuPermille = (uint64_t)ran * 1000 / elapsed;
+            if (task.cpuPermille > 1000) task.cpuPermille = 1000;
+            break;
+        }
+        // Whatever the idle task of a core did not get, the others did
+        if (task.core < 2 && task.cpuPermille != RESOURCE_UNKNOWN && strncmp(task.name, "IDLE", 4) == 0)
+        {
+            coreLoad[task.core] = 1000 - task.cpuPermille;
+        }
+#endif
+    }
+#if RESOURCE_IDLE_HOOKS
+    sampleIdleHooks(coreLoad);
+#endif
+
+    resources.taskCount = n;
+    metricSet(GAUGE_STACK_FREE_MIN, stackFreeMin);
+    metricSet(GAUGE_CPU0_PERMILLE, coreLoad[0]);
+    metricSet(GAUGE_CPU1_PERMILLE, coreLoad[1]);
+    memcpy(previous, current, n * sizeof(RunTimeMark));
+    previousCount = n;
+    previousTotal = total;
+}
+
+#else
+
+static void sampleTasks()
+{
+    uint16_t coreLoad[2] = {RESOURCE_UNKNOWN, RESOURCE_UNKNOWN};
+    sampleIdleHooks(coreLoad);
+    resources.taskCount = 0;
+    metricSet(GAUGE_STACK_FREE_MIN, 0);
+    metricSet(GAUGE_CPU0_PERMILLE, coreLoad[0]);
+    metricSet(GAUGE_CPU1_PERMILLE, coreLoad[1]);
+}
+
+#endif
+
+void sampleResources()
+{
+    metricSet(GAUGE_HEAP_FREE, heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    metricSet(GAUGE_HEAP_LARGEST, heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+    metricSet(GAUGE_HEAP_MIN_FREE, heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+    metricSet(GAUGE_PSRAM_FREE, heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    metricSet(GAUGE_PSRAM_LARGEST, heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
+    metricSet(GAUGE_PSRAM_MIN_FREE, heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM));
+    sampleTasks();
+}
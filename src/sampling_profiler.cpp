@@ -0,0 +1,172 @@
+#include <Arduino.h>
+#include "sampling_profiler.h"
+#include "serial_commands.h"
+#include "telemetry.h"
+
+#if SAMPLING_PROFILER
+
+// Start of the exception frame the Xtensa port saves on the task stack on
+// interrupt entry (XtExcFrame in xtensa_context.h). For the first nesting
+// level the port also stores its address in pxTopOfStack, the first member
+// of the running task's TCB.
+struct InterruptFrame
+{
+    uint32_t exit;
+    uint32_t pc;
+    uint32_t ps;
+    uint32_t a0;
+};
+
+extern "C" void* volatile pxCurrentTCB[portNUM_PROCESSORS];
+extern "C" volatile unsigned port_interruptNesting[portNUM_PROCESSORS];
+
+struct ProfileSample
+{
+    uint32_t pc;     // 0 when an interrupt was interrupted
+    uint32_t caller; // return address of the interrupted function
+    uint32_t task;   // TCB, the same as the TaskHandle_t
+};
+
+struct ProfileBuffer
+{
+    ProfileSample* samples;
+    volatile uint32_t count;
+};
+
+static ProfileBuffer buffers[portNUM_PROCESSORS];
+static hw_timer_t* timers[portNUM_PROCESSORS];
+static volatile bool profiling = false;
+
+static void IRAM_ATTR sampleInterrupt()
+{
+    uint8_t core = xPortGetCoreID();
+    ProfileBuffer& buffer = buffers[core];
+    if (!profiling || buffer.count >= PROFILER_SAMPLES) return;
+
+    ProfileSample& sample = buffer.samples[buffer.count];
+    void* tcb = pxCurrentTCB[core];
+    sample.task = (uintptr_t)tcb;
+    if (port_interruptNesting[core] > 1 || !tcb)
+    {
+        sample.pc = 0;
+        sample.caller = 0;
+    }
+    else
+    {
+        const InterruptFrame* frame = *(InterruptFrame* const*)tcb;
+        sample.pc = frame->pc;
+        // Windowed ABI: the top two bits of a0 hold the call size, the
+        // caller lives in the same 1 GB region as the PC
+        sample.caller = (frame->a0 & 0x3FFFFFFF) | (frame->pc & 0xC0000000);
+    }
+    buffer.count++;
+}
+
+// Interrupts are routed to the core that attaches them
+static void attachTimerTask(void* pvParameters)
+{
+    uint8_t core = xPortGetCoreID();
+    timers[core] = timerBegin(PROFILER_TIMER + core, 80, true); // 1 MHz
+    timerAttachInterrupt(timers[core], sampleInterrupt, true);
+    timerAlarmWrite(timers[core], 1000000 / PROFILER_HZ, true);
+    vTaskDelete(NULL);
+}
+
+static void setProfiling(bool on)
+{
+    profiling = on;
+    for (uint8_t c = 0; c < portNUM_PROCESSORS; c++)
+    {
+        if (!timers[c]) continue;
+        if (on)
+        {
+            timerAlarmEnable(timers[c]);
+        }
+        else
+        {
+            timerAlarmDisable(timers[c]);
+        }
+    }
+}
+
+// "profile begin <hz> <cores>", the tasks as "task <handle> <name>", per
+// core "core <n> <count>" and the samples as "<pc> <caller> <task>" in hex,
+// then "profile end"
+static void dumpProfile()
+{
+    Serial.printf("profile begin %d %d\n", PROFILER_HZ, portNUM_PROCESSORS);
+#if configUSE_TRACE_FACILITY
+    static TaskStatus_t status[32];
+    UBaseType_t n = uxTaskGetSystemState(status, 32, NULL);
+    for (UBaseType_t i = 0; i < n; i++)
+    {
+        Serial.printf("task %08lx %s\n", (unsigned long)(uintptr_t)status[i].xHandle, status[i].pcTaskName);
+    }
+#endif
+    for (uint8_t c = 0; c < portNUM_PROCESSORS; c++)
+    {
+        const ProfileBuffer& buffer = buffers[c];
+        Serial.printf("core %u %lu\n", c, (unsigned long)buffer.count);
+        for (uint32_t i = 0; i < buffer.count; i++)
+        {
+            const ProfileSample& s = buffer.samples[i];
+            Serial.printf("%08lx %08lx %08lx\n", (unsigned long)s.pc, (unsigned long)s.caller, (unsigned long)s.task);
+        }
+    }
+    Serial.println("profile end");
+}
+
+static void profileCommand(const char* args)
+{
+    if (!buffers[portNUM_PROCESSORS - 1].samples)
+    {
+        Serial.println("No PSRAM for the profiler");
+        return;
+    }
+    if (strcmp(args, "start") == 0)
+    {
+        setProfiling(false);
+        for (uint8_t c = 0; c < portNUM_PROCESSORS; c++) buffers[c].count = 0;
+        setProfiling(true);
+        Serial.printf("Profiling at %d Hz, %d s until the buffers are full\n", PROFILER_HZ, PROFILER_SAMPLES / PROFILER_HZ);
+    }
+    else if (strcmp(args, "stop") == 0)
+    {
+        setProfiling(false);
+        Serial.println("Profiling stopped");
+    }
+    else
+    {
+        setProfiling(false);
+        dumpProfile();
+    }
+}
+
+void beginSamplingProfiler()
+{
+    registerCommand("profile", "sampling profile, \"profile start\", \"profile stop\"", profileCommand);
+    for (uint8_t c = 0; c < portNUM_PROCESSORS; c++)
+    {
+        buffers[c].samples = (ProfileSample*)ps_malloc(PROFILER_SAMPLES * sizeof(ProfileSample));
+        if (!buffers[c].samples)
+        {
+            telemetryEvent(EVENT_UNAVAILABLE, FEATURE_PROFILER, 0);
+            return;
+        }
+        xTaskCreatePinnedToCore(attachTimerTask, "ProfTimer", 2048, NULL, 1, NULL, c);
+    }
+}
+
+#else
+
+static void profileCommand(const char* args)
+{
+    Serial.println("Built without SAMPLING_PROFILER");
+}
+
+void beginSamplingProfiler()
+{
+    registerCommand("profile", "sampling profile, \"profile start\", \"profile stop\"", profileCommand);
+}
+
+#endif
@@ -0,0 +1,61 @@
+#include <Arduino.h>
+#include "serial_commands.h"
+
+struct SerialCommand
+{
+    const char* name;
+    const char* help;
+    SerialCommandHandler handler;
+};
+
+static SerialCommand commands[SERIAL_COMMAND_MAX];
+static uint8_t commandCount = 0;
+static char line[SERIAL_LINE_MAX];
+static uint8_t lineLength = 0;
+
+void registerCommand(const char* name, const char* help, SerialCommandHandler handler)
+{
+    if (commandCount < SERIAL_COMMAND_MAX) commands[commandCount++] = {name, help, handler};
+}
+
+static void runLine()
+{
+    char* args = line;
+    while (*args && *args != ' ') args++;
+    size_t nameLength = args - line;
+    while (*args == ' ') args++;
+    if (nameLength == 0) return;
+
+    for (uint8_t i = 0; i < commandCount; i++)
+    {
+        if (strlen(commands[i].name) == nameLength && strncmp(commands[i].name, line, nameLength) == 0)
+        {
+            commands[i].handler(args);
+            return;
+        }
+    }
+
+    Serial.println("Commands:");
+    for (uint8_t i = 0; i < commandCount; i++)
+    {
+        Serial.printf("  %-10s %s\n", commands[i].name, commands[i].help);
+    }
+}
+
+void pollSerialCommands()
+{
+    while (Serial.available() > 0)
+    {
+        char c = Serial.read();
+        if (c == '\r' || c == '\n')
+        {
+            line[lineLength] = 0;
+            runLine();
+            lineLength = 0;
+        }
+        else if (lineLength < SERIAL_LINE_MAX - 1)
+        {
+            line[lineLength++] = c;
+        }
+    }
+}
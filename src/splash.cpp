@@ -0,0 +1,69 @@
+#include <M5Unified.h>
+#include <esp_heap_caps.h>
+#include "splash.h"
+#include "m5_logo_rle.h"
+
+// Decoder state, runs and literals may cross chunk boundaries
+struct RleStream
+{
+    const uint8_t* p;
+    uint16_t pixel;
+    uint8_t run;     // repeats of pixel left
+    uint8_t literal; // literal pixels left
+};
+
+static uint16_t nextPixel(RleStream& s)
+{
+    if (s.run)
+    {
+        s.run--;
+        return s.pixel;
+    }
+    if (!s.literal)
+    {
+        uint8_t c = *s.p++;
+        if (c >= 128)
+        {
+            s.pixel = s.p[0] | (s.p[1] << 8);
+            s.p += 2;
+            s.run = c - 127; // c - 126 repeats, one returned now
+            return s.pixel;
+        }
+        s.literal = c + 1;
+    }
+    s.literal--;
+    uint16_t pixel = s.p[0] | (s.p[1] << 8);
+    s.p += 2;
+    return pixel;
+}
+
+void drawSplash()
+{
+    const size_t chunkPixels = LOGO_WIDTH * SPLASH_CHUNK_ROWS;
+    uint16_t* buffers[2];
+    buffers[0] = (uint16_t*)heap_caps_malloc(chunkPixels * 2, MALLOC_CAP_DMA);
+    buffers[1] = (uint16_t*)heap_caps_malloc(chunkPixels * 2, MALLOC_CAP_DMA);
+    if (!buffers[0] || !buffers[1])
+    {
+        free(buffers[0]);
+        free(buffers[1]);
+        return;
+    }
+
+    RleStream stream = {gImage_logoM5_rle, 0, 0, 0};
+    uint8_t current = 0;
+    M5.Lcd.startWrite();
+    for (int16_t y = 0; y < LOGO_HEIGHT; y += SPLASH_CHUNK_ROWS)
+    {
+        int16_t rows = min((int16_t)SPLASH_CHUNK_ROWS, (int16_t)(LOGO_HEIGHT - y));
+        uint16_t* out = buffers[current];
+        for (size_t i = 0; i < (size_t)rows * LOGO_WIDTH; i++) out[i] = nextPixel(stream);
+        // Waits for the previous chunk, whose buffer is decoded into next
+        M5.Lcd.pushImageDMA(0, y, LOGO_WIDTH, rows, out);
+        current ^= 1;
+    }
+    M5.Lcd.endWrite();
+
+    free(buffers[0]);
+    free(buffers[1]);
+}
@@ -0,0 +1,60 @@
+#include <Arduino.h>
+#include "stage_profiler.h"
+#include "serial_commands.h"
+
+#if PROFILE_STAGES
+
+static LogHistogram stages[STAGE_COUNT];
+static const char* const stageNames[STAGE_COUNT] = {"read", "parse", "wait", "spi load", "tx done"};
+
+void recordStage(uint8_t stage, uint32_t cycles)
+{
+    stages[stage].record(cycles);
+}
+
+uint32_t stageCycles(uint8_t stage)
+{
+    return (uint32_t)stages[stage].sum;
+}
+
+const LogHistogram& stageHistogram(uint8_t stage)
+{
+    return stages[stage];
+}
+
+static void dumpStages(const char* args)
+{
+    if (strcmp(args, "reset") == 0)
+    {
+        memset(stages, 0, sizeof(stages));
+        Serial.println("Stage profile reset");
+        return;
+    }
+    float mhz = ESP.getCpuFreqMHz();
+    Serial.println("stage        count     min us    mean us     max us     p99 us");
+    for (uint8_t s = 0; s < STAGE_COUNT; s++)
+    {
+        const LogHistogram& h = stages[s];
+        if (h.count == 0)
+        {
+            Serial.printf("%-9s %8u\n", stageNames[s], 0);
+            continue;
+        }
+        Serial.printf("%-9s %8lu %10.2f %10.2f %10.2f %10.2f\n", stageNames[s], (unsigned long)h.count,
+                      h.min / mhz, (double)h.sum / h.count / mhz, h.max / mhz, h.quantile(990) / mhz);
+    }
+}
+
+#else
+
+static void dumpStages(const char* args)
+{
+    Serial.println("Built without PROFILE_STAGES");
+}
+
+#endif
+
+void beginStageProfiler()
+{
+    registerCommand("stages", "replay stage timing, \"stages reset\" clears", dumpStages);
+}
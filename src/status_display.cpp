@@ -0,0 +1,217 @@
+#include <M5Unified.h>
+#include "status_display.h"
+#include "metrics.h"
+#include "top_talkers.h"
+#include "bus_graph.h"
+#include "trace_buffer.h"
+#include "resource_monitor.h"
+
+// Screen layout: talker rows from TALKER_TOP, the resource line right
+// above the bus graph at the bottom
+#define TALKER_TOP 84
+#define TALKER_PITCH 20
+#define TALKER_HEIGHT 16
+#define RESOURCE_HEIGHT 8
+#define GRAPH_TOP (240 - GRAPH_HEIGHT)
+#define RESOURCE_TOP (GRAPH_TOP - RESOURCE_HEIGHT)
+
+static_assert(TALKER_TOP + (TOP_TALKERS_SHOWN - 1) * TALKER_PITCH + TALKER_HEIGHT <= RESOURCE_TOP,
+              "the top talker rows run into the resource line, lower TOP_TALKERS_SHOWN");
+
+// One text field of the status screen. Fields of the same shape share a
+// sprite; a field is rendered and pushed in one go.
+struct Field
+{
+    M5Canvas* sprite;
+    int16_t x;
+    int16_t y;
+    char text[64];
+};
+
+// Counters as seen by the UI, read from the metrics registry
+struct StatusSnapshot
+{
+    unsigned long count;
+    unsigned long perSecond;
+};
+
+static bool showReceived = false;
+static M5Canvas countSprite;
+static M5Canvas rateSprite;
+static M5Canvas rowSprite;
+static M5Canvas resourceSprite;
+static Field countField;
+static Field rateField;
+static Field talkerRows[TOP_TALKERS_SHOWN];
+static Field resourceField;
+static TalkerEntry previousTalkers[TOP_TALKERS_SIZE];
+
+static void initSprite(M5Canvas& sprite, int16_t width, int16_t height, uint8_t textSize)
+{
+    // DMA reads the sprite, so it has to stay in internal RAM
+    sprite.setPsram(false);
+    sprite.setColorDepth(16);
+    sprite.createSprite(width, height);
+    sprite.setTextSize(textSize);
+    sprite.setTextColor(WHITE, BLACK);
+}
+
+static void initField(Field& field, M5Canvas& sprite, int16_t x, int16_t y)
+{
+    field.sprite = &sprite;
+    field.x = x;
+    field.y = y;
+    field.text[0] = 0;
+}
+
+void pushSpriteDMA(M5Canvas& sprite, int16_t x, int16_t y)
+{
+    int16_t width = sprite.width();
+    int16_t height = sprite.height();
+    const lgfx::swap565_t* pixels = (const lgfx::swap565_t*)sprite.getBuffer();
+    for (int16_t row = 0; row < height; row += DISPLAY_CHUNK_ROWS)
+    {
+        int16_t rows = min((int16_t)DISPLAY_CHUNK_ROWS, (int16_t)(height - row));
+        M5.Lcd.startWrite();
+        M5.Lcd.pushImageDMA(x, y + row, width, rows, pixels + row * width);
+        M5.Lcd.endWrite();
+    }
+}
+
+static void updateField(Field& field, const char* text)
+{
+    if (strcmp(text, field.text) == 0) return;
+    strlcpy(field.text, text, sizeof(field.text));
+    field.sprite->fillSprite(BLACK);
+    field.sprite->setCursor(0, 0);
+    field.sprite->print(text);
+    pushSpriteDMA(*field.sprite, field.x, field.y);
+}
+
+static void takeSnapshot(StatusSnapshot& snapshot)
+{
+    static unsigned long lastCount = 0;
+    unsigned long count = metricCount(showReceived ? METRIC_RECEIVED : METRIC_TRANSMITTED);
+    snapshot.count = count;
+    snapshot.perSecond = (count - lastCount) * 1000 / DISPLAY_PERIOD_MS;
+    lastCount = count;
+}
+
+// Frames and bits per counter since the last refresh give the rate and the
+// share of the bus load. A counter that changed owners continues from the
+// old count, so the difference is still the traffic of the new ID.
+static void updateTopTalkers()
+{
+    struct Row
+    {
+        uint32_t key;
+        uint32_t frames;
+        uint32_t bits;
+    } top[TOP_TALKERS_SHOWN] = {};
+    uint32_t totalBits = 0;
+
+    const TalkerEntry* current = topTalkers.entries();
+    for (uint16_t i = 0; i < TOP_TALKERS_SIZE; i++)
+    {
+        TalkerEntry entry = current[i];
+        uint32_t frames = entry.frames - previousTalkers[i].frames;
+        uint32_t bits = entry.bits - previousTalkers[i].bits;
+        previousTalkers[i] = entry;
+        totalBits += bits;
+
+        if (frames == 0 || frames <= top[TOP_TALKERS_SHOWN - 1].frames) continue;
+        int8_t j = TOP_TALKERS_SHOWN - 1;
+        while (j > 0 && top[j - 1].frames < frames)
+        {
+            top[j] = top[j - 1];
+            j--;
+        }
+        top[j] = {entry.key, frames, bits};
+    }
+
+    char text[32];
+    for (uint8_t r = 0; r < TOP_TALKERS_SHOWN; r++)
+    {
+        text[0] = 0;
+        if (top[r].frames)
+        {
+            snprintf(text, sizeof(text), (top[r].key & 0x80000000UL) ? "%08lX %6lu/s %3lu%%" : "%8lX %6lu/s %3lu%%",
+                     (unsigned long)(top[r].key & 0x1FFFFFFFUL),
+                     (unsigned long)top[r].frames * 1000 / DISPLAY_PERIOD_MS,
+                     (unsigned long)((uint64_t)top[r].bits * 100 / totalBits));
+        }
+        updateField(talkerRows[r], text);
+    }
+}
+
+// One line of size 1 text, 53 characters across the screen: load of both
+// cores, internal RAM free/largest block/minimum ever free, PSRAM free and
+// the least stack headroom of any task, at most 48 characters as in
+// "CPU 100/100% RAM 320/110/250k PS 4096k stk 65535"
+static void updateResources()
+{
+    char text[64];
+    char cpu[12] = "--";
+    uint32_t cpu0 = metricGauge(GAUGE_CPU0_PERMILLE);
+    uint32_t cpu1 = metricGauge(GAUGE_CPU1_PERMILLE);
+    if (cpu0 != RESOURCE_UNKNOWN && cpu1 != RESOURCE_UNKNOWN)
+    {
+        snprintf(cpu, sizeof(cpu), "%lu/%lu%%", (unsigned long)cpu0 / 10, (unsigned long)cpu1 / 10);
+    }
+    snprintf(text, sizeof(text), "CPU %s RAM %lu/%lu/%luk PS %luk stk %lu",
+             cpu,
+             (unsigned long)metricGauge(GAUGE_HEAP_FREE) / 1024,
+             (unsigned long)metricGauge(GAUGE_HEAP_LARGEST) / 1024,
+             (unsigned long)metricGauge(GAUGE_HEAP_MIN_FREE) / 1024,
+             (unsigned long)metricGauge(GAUGE_PSRAM_FREE) / 1024,
+             (unsigned long)metricGauge(GAUGE_STACK_FREE_MIN));
+    updateField(resourceField, text);
+}
+
+void StatusDisplayTask(void* pvParameters)
+{
+    char text[16];
+    StatusSnapshot snapshot;
+    uint16_t tick = 0;
+    TickType_t wake = xTaskGetTickCount();
+    while (true)
+    {
+        updateBusGraph();
+        if (++tick >= DISPLAY_PERIOD_MS / GRAPH_SAMPLE_MS)
+        {
+            tick = 0;
+            takeSnapshot(snapshot);
+            snprintf(text, sizeof(text), "%9lu", snapshot.count); // Total count
+            updateField(countField, text);
+            snprintf(text, sizeof(text), "%lu/s", snapshot.perSecond);
+            updateField(rateField, text);
+            updateTopTalkers();
+            updateResources();
+        }
+        TRACE(TRACE_TASK_WAIT, TRACE_UI);
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(GRAPH_SAMPLE_MS));
+        TRACE(TRACE_TASK_RUN, TRACE_UI);
+    }
+}
+
+void startStatusDisplay(bool recordMode)
+{
+    showReceived = recordMode;
+    M5.Lcd.fillRect(0, 20, 320, 60, BLACK);
+    initSprite(countSprite, 216, 32, 4);
+    initSprite(rateSprite, 100, 16, 2);
+    initSprite(rowSprite, 320, TALKER_HEIGHT, 2);
+    initSprite(resourceSprite, 320, RESOURCE_HEIGHT, 1);
+    initField(countField, countSprite, 0, 20);
+    initField(rateField, rateSprite, 220, 25);
+
+    M5.Lcd.setCursor(0, 70);
+    M5.Lcd.println("Top talkers: ID, frames/s, share of bus load");
+    for (uint8_t r = 0; r < TOP_TALKERS_SHOWN; r++)
+    {
+        initField(talkerRows[r], rowSprite, 0, TALKER_TOP + r * TALKER_PITCH);
+    }
+    initField(resourceField, resourceSprite, 0, RESOURCE_TOP);
+    initBusGraph(GRAPH_TOP);
+    xTaskCreatePinnedToCore(StatusDisplayTask, "StatusUI", 4096, NULL, 1, NULL, 0);
+}
@@ -0,0 +1,249 @@
+#include <Arduino.h>
+#include "telemetry.h"
+#include "metrics.h"
+#include "stage_profiler.h"
+#include "resource_monitor.h"
+
+struct TelemetryEventRecord
+{
+    uint32_t timeMs;
+    uint8_t code;
+    uint8_t detail;
+    uint32_t arg;
+};
+
+static QueueHandle_t eventQueue = NULL;
+static bool showReceived = false;
+
+void telemetryEvent(uint8_t code, uint8_t detail, uint32_t arg)
+{
+    TelemetryEventRecord event = {(uint32_t)millis(), code, detail, arg};
+    if (!eventQueue || xQueueSend(eventQueue, &event, 0) != pdTRUE)
+    {
+        metricAdd(METRIC_EVENTS_DROPPED);
+    }
+}
+
+// ==================== Framing ====================
+
+// Little-endian message under construction
+class TelemetryMessage
+{
+public:
+    TelemetryMessage(uint8_t type)
+    {
+        static uint8_t sequence = 0;
+        put8(type);
+        put8(sequence++);
+    }
+
+    void put8(uint8_t value)
+    {
+        if (used < sizeof(data)) data[used++] = value;
+    }
+
+    void put32(uint32_t value)
+    {
+        for (uint8_t i = 0; i < 4; i++) put8(value >> (8 * i));
+    }
+
+    void put64(uint64_t value)
+    {
+        put32((uint32_t)value);
+        put32((uint32_t)(value >> 32));
+    }
+
+    // Appends the CRC, COBS encodes the message and writes it in one call,
+    // so text from other tasks cannot end up inside a frame
+    void send()
+    {
+        uint16_t crc = 0xFFFF;
+        for (size_t i = 0; i < used; i++)
+        {
+            crc ^= (uint16_t)data[i] << 8;
+            for (uint8_t b = 0; b < 8; b++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+        put8(crc);
+        put8(crc >> 8);
+
+        // Every code byte covers at most 254 data bytes
+        static uint8_t frame[TELEMETRY_MAX_MESSAGE + TELEMETRY_MAX_MESSAGE / 254 + 4];
+        size_t out = 0;
+        frame[out++] = 0;
+        size_t code = out++;
+        uint8_t run = 1;
+        for (size_t i = 0; i < used; i++)
+        {
+            if (data[i] == 0)
+            {
+                frame[code] = run;
+                code = out++;
+                run = 1;
+                continue;
+            }
+            frame[out++] = data[i];
+            if (++run == 0xFF)
+            {
+                frame[code] = run;
+                code = out++;
+                run = 1;
+            }
+        }
+        frame[code] = run;
+        frame[out++] = 0;
+        Serial.write(frame, out);
+    }
+
+private:
+    uint8_t data[TELEMETRY_MAX_MESSAGE];
+    size_t used = 0;
+};
+
+// ==================== Messages ====================
+
+static void sendCounters()
+{
+    uint64_t counters[COUNTER_COUNT];
+    counters[COUNTER_UPTIME_MS] = millis();
+    counters[COUNTER_FREE_HEAP] = metricGauge(GAUGE_HEAP_FREE);
+    counters[COUNTER_RECEIVED] = metricCount(METRIC_RECEIVED);
+    counters[COUNTER_DROPPED] = metricCount(METRIC_DROPPED);
+    counters[COUNTER_FILTERED] = metricCount(METRIC_FILTERED);
+    counters[COUNTER_UNCHANGED] = metricCount(METRIC_UNCHANGED);
+    counters[COUNTER_TRANSMITTED] = metricCount(METRIC_TRANSMITTED);
+    counters[COUNTER_LATE] = metricCount(METRIC_LATE);
+    counters[COUNTER_EARLY] = metricCount(METRIC_EARLY);
+    counters[COUNTER_TIMING_ERROR_SUM_US] = metricCount(METRIC_TIMING_ERROR_SUM_US);
+    counters[COUNTER_TIMING_ERROR_COUNT] = metricCount(METRIC_TIMING_ERROR_COUNT);
+    counters[COUNTER_LZ4_BLOCKS] = metricCount(METRIC_LZ4_BLOCKS);
+    counters[COUNTER_LZ4_IN_BYTES] = metricCount(METRIC_LZ4_IN_BYTES);
+    counters[COUNTER_LZ4_OUT_BYTES] = metricCount(METRIC_LZ4_OUT_BYTES);
+    counters[COUNTER_LZ4_MICROS] = metricCount(METRIC_LZ4_MICROS);
+    counters[COUNTER_EVENTS_DROPPED] = metricCount(METRIC_EVENTS_DROPPED);
+    counters[COUNTER_HEAP_LARGEST] = metricGauge(GAUGE_HEAP_LARGEST);
+    counters[COUNTER_HEAP_MIN_FREE] = metricGauge(GAUGE_HEAP_MIN_FREE);
+    counters[COUNTER_PSRAM_FREE] = metricGauge(GAUGE_PSRAM_FREE);
+    counters[COUNTER_PSRAM_LARGEST] = metricGauge(GAUGE_PSRAM_LARGEST);
+    counters[COUNTER_PSRAM_MIN_FREE] = metricGauge(GAUGE_PSRAM_MIN_FREE);
+    counters[COUNTER_STACK_FREE_MIN] = metricGauge(GAUGE_STACK_FREE_MIN);
+    counters[COUNTER_CPU0_PERMILLE] = metricGauge(GAUGE_CPU0_PERMILLE);
+    counters[COUNTER_CPU1_PERMILLE] = metricGauge(GAUGE_CPU1_PERMILLE);
+    counters[COUNTER_REANCHORS] = metricCount(METRIC_REANCHORS);
+
+    TelemetryMessage message(TELEMETRY_COUNTERS);
+    message.put8(showReceived ? 1 : 0);
+    message.put8(COUNTER_COUNT);
+    for (uint8_t i = 0; i < COUNTER_COUNT; i++) message.put64(counters[i]);
+    message.send();
+}
+
+// Only the occupied buckets are sent. The histogram is read while its
+// owner keeps writing, a message may be off by the values of that moment.
+static void sendHistogram(uint8_t id, const LogHistogram& h)
+{
+    if (h.count == 0) return;
+    TelemetryMessage message(TELEMETRY_HISTOGRAM);
+    message.put8(id);
+    message.put32(h.count);
+    message.put32(h.min);
+    message.put32(h.max);
+    message.put64(h.sum);
+    uint8_t n = 0;
+    for (uint8_t b = 0; b < LOG_HISTOGRAM_BUCKETS; b++)
+    {
+        if (h.buckets[b]) n++;
+    }
+    message.put8(n);
+    for (uint8_t b = 0; b < LOG_HISTOGRAM_BUCKETS; b++)
+    {
+        if (!h.buckets[b]) continue;
+        message.put8(b);
+        message.put32(h.buckets[b]);
+    }
+    message.send();
+}
+
+static void sendHistograms()
+{
+    if (!showReceived)
+    {
+        LogHistogram deviation;
+        metricHistogram(HIST_SCHEDULE_DEVIATION, deviation);
+        sendHistogram(HISTOGRAM_SCHEDULE_DEVIATION, deviation);
+    }
+#if PROFILE_STAGES
+    for (uint8_t s = 0; s < STAGE_COUNT; s++)
+    {
+        sendHistogram(HISTOGRAM_STAGE + s, stageHistogram(s));
+    }
+#endif
+}
+
+static void sendTasks()
+{
+    TelemetryMessage message(TELEMETRY_TASKS);
+    message.put8(resources.taskCount);
+    for (uint8_t i = 0; i < resources.taskCount; i++)
+    {
+        const TaskResources& task = resources.tasks[i];
+        for (uint8_t c = 0; c < RESOURCE_NAME_LEN; c++) message.put8(task.name[c]);
+        message.put8(task.core);
+        message.put8(task.cpuPermille);
+        message.put8(task.cpuPermille >> 8);
+        message.put32(task.stackFreeMin);
+    }
+    message.send();
+}
+
+static void sendEvent(const TelemetryEventRecord& event)
+{
+    TelemetryMessage message(TELEMETRY_EVENT);
+    message.put32(event.timeMs);
+    message.put8(event.code);
+    message.put8(event.detail);
+    message.put32(event.arg);
+    message.send();
+}
+
+// ==================== Telemetry Task ====================
+
+void TelemetryTask(void* pvParameters)
+{
+    TelemetryEventRecord event;
+    uint8_t periods = 0;
+    uint32_t lastCounters = millis();
+    while (true)
+    {
+        // Checked first, so a burst of events cannot hold back the counters
+        uint32_t elapsed = millis() - lastCounters;
+        if (elapsed >= TELEMETRY_PERIOD_MS)
+        {
+            lastCounters = millis();
+            sampleResources();
+            sendCounters();
+            if (++periods >= TELEMETRY_HISTOGRAM_PERIOD)
+            {
+                periods = 0;
+                sendHistograms();
+                sendTasks();
+            }
+            continue;
+        }
+        if (xQueueReceive(eventQueue, &event, pdMS_TO_TICKS(TELEMETRY_PERIOD_MS - elapsed)) == pdTRUE)
+        {
+            sendEvent(event);
+        }
+    }
+}
+
+void beginTelemetry()
+{
+    eventQueue = xQueueCreate(TELEMETRY_EVENT_QUEUE, sizeof(TelemetryEventRecord));
+}
+
+void startTelemetry(bool recordMode)
+{
+    showReceived = recordMode;
+    if (!eventQueue) return;
+    xTaskCreatePinnedToCore(TelemetryTask, "Telemetry", 4096, NULL, tskIDLE_PRIORITY, NULL, 0);
+}
@@ -0,0 +1,3 @@
+#include "top_talkers.h"
+
+TopTalkers topTalkers;
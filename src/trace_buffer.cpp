@@ -0,0 +1,105 @@
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "trace_buffer.h"
+#include "serial_commands.h"
+#include "telemetry.h"
+
+#if TRACE_BUFFER
+
+struct TraceRecord
+{
+    uint32_t timeUs; // low 32 bits, the converter unwraps them
+    uint8_t event;
+    uint8_t reserved[3];
+    uint32_t arg;
+};
+
+struct TraceRing
+{
+    TraceRecord* records;
+    uint32_t head; // records ever written, the slot is head % TRACE_EVENTS
+};
+
+static TraceRing rings[portNUM_PROCESSORS];
+static volatile bool tracing = false;
+
+void IRAM_ATTR traceEvent(uint8_t event, uint32_t arg)
+{
+    if (!tracing) return;
+    TraceRing& ring = rings[xPortGetCoreID()];
+    // A task preempted here by an interrupt or a higher priority task on
+    // the same core simply ends up one slot further on
+    uint32_t slot = __atomic_fetch_add(&ring.head, 1, __ATOMIC_RELAXED) & (TRACE_EVENTS - 1);
+    TraceRecord& r = ring.records[slot];
+    r.timeUs = (uint32_t)esp_timer_get_time();
+    r.event = event;
+    r.arg = arg;
+}
+
+// "trace begin <cores> <now>", per core "core <n> <count>" and the records
+// oldest first as "<time> <event> <arg>" in hex, then "trace end"
+static void dumpTrace(const char* args)
+{
+    if (!tracing)
+    {
+        Serial.println("No PSRAM for the trace buffer");
+        return;
+    }
+    if (strcmp(args, "clear") == 0)
+    {
+        tracing = false;
+        for (uint8_t c = 0; c < portNUM_PROCESSORS; c++) rings[c].head = 0;
+        tracing = true;
+        Serial.println("Trace cleared");
+        return;
+    }
+    uint32_t last = *args ? strtoul(args, NULL, 10) : TRACE_EVENTS;
+
+    // Stopped while printing, so the rings do not overtake the dump. A record
+    // that was already being written when tracing stopped completes within
+    // microseconds, long before the first line has left the UART.
+    tracing = false;
+    Serial.printf("trace begin %d %lu\n", portNUM_PROCESSORS, (unsigned long)esp_timer_get_time());
+    for (uint8_t c = 0; c < portNUM_PROCESSORS; c++)
+    {
+        const TraceRing& ring = rings[c];
+        uint32_t count = min(min(ring.head, (uint32_t)TRACE_EVENTS), last);
+        Serial.printf("core %u %lu\n", c, (unsigned long)count);
+        for (uint32_t i = ring.head - count; i != ring.head; i++)
+        {
+            const TraceRecord& r = ring.records[i & (TRACE_EVENTS - 1)];
+            Serial.printf("%08lx %x %lx\n", (unsigned long)r.timeUs, r.event, (unsigned long)r.arg);
+        }
+    }
+    Serial.println("trace end");
+    tracing = true;
+}
+
+void beginTraceBuffer()
+{
+    registerCommand("trace", "event trace dump, \"trace N\" last N per core, \"trace clear\"", dumpTrace);
+    for (uint8_t c = 0; c < portNUM_PROCESSORS; c++)
+    {
+        rings[c].records = (TraceRecord*)ps_malloc(TRACE_EVENTS * sizeof(TraceRecord));
+        if (!rings[c].records)
+        {
+            telemetryEvent(EVENT_UNAVAILABLE, FEATURE_TRACE, 0);
+            return;
+        }
+    }
+    tracing = true;
+}
+
+#else
+
+static void dumpTrace(const char* args)
+{
+    Serial.println("Built without TRACE_BUFFER");
+}
+
+void beginTraceBuffer()
+{
+    registerCommand("trace", "event trace dump, \"trace N\" last N per core, \"trace clear\"", dumpTrace);
+}
+
+#endif
@@ -0,0 +1,145 @@
+#include <esp_timer.h>
+#include "trigger_capture.h"
+#include "telemetry.h"
+
+static const uint32_t ringMask = TRIGGER_RING_FRAMES - 1;
+static_assert((TRIGGER_RING_FRAMES & ringMask) == 0, "TRIGGER_RING_FRAMES must be a power of two");
+
+// Set by loop() on core 1, taken by the writer task on core 0. The 64-bit
+// time is two words, the lock keeps the writer from reading half of it.
+static portMUX_TYPE buttonLock = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool buttonTrigger = false;
+static int64_t buttonTriggerUs = 0;
+
+void requestTrigger()
+{
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&buttonLock);
+    buttonTriggerUs = now;
+    buttonTrigger = true;
+    portEXIT_CRITICAL(&buttonLock);
+}
+
+bool TriggerCapture::begin()
+{
+    ring = (CanFrame*)ps_malloc(TRIGGER_RING_FRAMES * sizeof(CanFrame));
+    if (!ring)
+    {
+        telemetryEvent(EVENT_UNAVAILABLE, FEATURE_TRIGGER, 0);
+        return false;
+    }
+    telemetryEvent(EVENT_TRIGGER, TRIGGER_ARMED, TRIGGER_PRE_MS);
+    return sink->begin();
+}
+
+bool TriggerCapture::matches(const CanFrame& frame) const
+{
+    if (frame.flags & CAN_FRAME_ERR) return TRIGGER_ON_ERROR;
+
+#if defined(TRIGGER_ID) || defined(TRIGGER_MASK)
+#ifdef TRIGGER_ID
+    if (frame.id != (uint32_t)(TRIGGER_ID)) return false;
+#endif
+#ifdef TRIGGER_MASK
+    uint64_t payload = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        payload = (payload << 8) | (i < frame.len ? frame.data[i] : 0);
+    }
+    if ((payload & (uint64_t)(TRIGGER_MASK)) != ((uint64_t)(TRIGGER_DATA) & (uint64_t)(TRIGGER_MASK))) return false;
+#endif
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Start a capture, or extend the running one
+void TriggerCapture::fire(int64_t when, uint8_t reason)
+{
+    if (!capturing)
+    {
+        // Timestamps in the ring are ascending, find the first frame inside
+        // the pre-trigger window
+        int64_t from = when - (int64_t)TRIGGER_PRE_MS * 1000;
+        uint32_t lo = 0;
+        uint32_t hi = stored;
+        while (lo < hi)
+        {
+            uint32_t mid = lo + (hi - lo) / 2;
+            if (ring[(head - stored + mid) & ringMask].timestampUs < from)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        // After an earlier capture the cursor is still on the first frame it
+        // did not write; never go back behind it, those frames are on the card
+        uint32_t first = head - stored + lo;
+        if ((int32_t)(first - cursor) < 0) first = cursor;
+        cursor = first;
+        capturing = true;
+        telemetryEvent(EVENT_TRIGGER, reason, head - cursor);
+    }
+    captureEndUs = when + (int64_t)TRIGGER_POST_MS * 1000;
+}
+
+// Called per frame, the lock is only taken after a press
+void TriggerCapture::checkButton()
+{
+    if (!buttonTrigger) return;
+    portENTER_CRITICAL(&buttonLock);
+    int64_t when = buttonTriggerUs;
+    buttonTrigger = false;
+    portEXIT_CRITICAL(&buttonLock);
+    fire(when, TRIGGER_BY_BUTTON);
+}
+
+void TriggerCapture::drain(uint32_t limit)
+{
+    while (capturing && limit-- && cursor != head)
+    {
+        const CanFrame& frame = ring[cursor & ringMask];
+        if (frame.timestampUs > captureEndUs)
+        {
+            capturing = false;
+            telemetryEvent(EVENT_TRIGGER, TRIGGER_COMPLETE, 0);
+            break;
+        }
+        sink->write(frame);
+        cursor++;
+    }
+}
+
+void TriggerCapture::write(const CanFrame& frame)
+{
+    ring[head & ringMask] = frame;
+    head++;
+    if (stored < TRIGGER_RING_FRAMES) stored++;
+
+    // The sink fell a full ring behind, skip what was overwritten
+    if (capturing && head - cursor > TRIGGER_RING_FRAMES)
+    {
+        overrun += head - cursor - TRIGGER_RING_FRAMES;
+        cursor = head - TRIGGER_RING_FRAMES;
+        telemetryEvent(EVENT_TRIGGER, TRIGGER_OVERRUN, overrun);
+    }
+
+    if (matches(frame)) fire(frame.timestampUs, (frame.flags & CAN_FRAME_ERR) ? TRIGGER_BY_ERROR : TRIGGER_BY_FRAME);
+    checkButton();
+    drain(TRIGGER_DRAIN_BATCH);
+}
+
+void TriggerCapture::flush()
+{
+    checkButton();
+    drain(TRIGGER_DRAIN_BATCH * 16);
+    sink->flush();
+}
+
+void TriggerCapture::end()
+{
+    drain(TRIGGER_RING_FRAMES);
+    sink->end();
+    free(ring);
+    ring = nullptr;
+}
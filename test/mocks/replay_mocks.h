@@ -0,0 +1,92 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "log_source.h"
+#include "replay_engine.h"
+
+// Host stand-ins for the SD card, the MCP2515 and the task clock
+
+// Log bytes from memory, handed out at most maxRead at a time to exercise
+// the block buffer
+class MemorySource : public LogSource
+{
+public:
+    explicit MemorySource(const std::string& text, size_t maxRead = SIZE_MAX) : text(text), maxRead(maxRead) {}
+    size_t read(uint8_t* buf, size_t n) override
+    {
+        if (n > maxRead) n = maxRead;
+        if (n > text.size() - pos) n = text.size() - pos;
+        memcpy(buf, text.data() + pos, n);
+        pos += n;
+        return n;
+    }
+    const char* name() const override { return "memory"; }
+
+private:
+    std::string text;
+    size_t maxRead;
+    size_t pos = 0;
+};
+
+// Simulated time. Sleeps round down to resolutionUs like vTaskDelay does
+// to ticks, and overshoot by latencyUs like a task that is woken late.
+class MockClock : public ReplayClock
+{
+public:
+    int64_t nowUs() override { return now; }
+    void sleepUs(int64_t us) override
+    {
+        us -= us % resolutionUs;
+        if (us == 0) return;
+        now += us + latencyUs;
+        sleeps++;
+    }
+
+    int64_t now = 1000000;
+    int64_t resolutionUs = 1;
+    int64_t latencyUs = 0;
+    uint32_t sleeps = 0;
+};
+
+struct SentFrame
+{
+    CanFrame frame;
+    int64_t timeUs;
+};
+
+// Records what was sent and when; busy and failStatus script the answers
+class MockCan : public CanController
+{
+public:
+    explicit MockCan(MockClock& clock) : clock(clock) {}
+    uint8_t transmit(const CanFrame& frame) override
+    {
+        attempts++;
+        if (busy > 0)
+        {
+            busy--;
+            return CAN_GETTXBFTIMEOUT;
+        }
+        if (failStatus != CAN_OK) return failStatus;
+        sent.push_back({frame, clock.now});
+        clock.now += costUs;
+        return CAN_OK;
+    }
+
+    MockClock& clock;
+    std::vector<SentFrame> sent;
+    uint32_t attempts = 0;
+    uint32_t busy = 0;           // attempts answered with CAN_GETTXBFTIMEOUT
+    uint8_t failStatus = CAN_OK; // answer once not busy
+    int64_t costUs = 0;          // time a transmit takes
+};
+
+inline CanFrame makeFrame(int64_t timestampUs, uint32_t id, uint8_t flags = 0)
+{
+    CanFrame frame = {};
+    frame.timestampUs = timestampUs;
+    frame.id = id;
+    frame.flags = flags;
+    frame.len = 8;
+    return frame;
+}
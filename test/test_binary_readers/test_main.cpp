@@ -0,0 +1,372 @@
+#include <unity.h>
+#include <zlib.h>
+#include "frame_reader.h"
+#include "delta_log.h"
+#include "pcapng.h"
+#include "blf.h"
+#include "mdf4.h"
+#include "../mocks/replay_mocks.h"
+
+// Files of the binary formats built byte by byte, little endian
+
+void setUp() {}
+void tearDown() {}
+
+static void put8(std::string& s, uint8_t v)
+{
+    s.push_back((char)v);
+}
+
+static void put16(std::string& s, uint16_t v)
+{
+    s.append((const char*)&v, 2);
+}
+
+static void put32(std::string& s, uint32_t v)
+{
+    s.append((const char*)&v, 4);
+}
+
+static void put64(std::string& s, uint64_t v)
+{
+    s.append((const char*)&v, 8);
+}
+
+static FrameReader* openReader(MemorySource& source, const char* name)
+{
+    FrameReader* reader = openFrameReader(&source);
+    TEST_ASSERT_NOT_NULL(reader);
+    TEST_ASSERT_EQUAL_STRING(name, reader->name());
+    return reader;
+}
+
+static void test_delta_records()
+{
+    std::string log = DELTA_MAGIC;
+    put8(log, 1);
+    put8(log, 0);
+    put16(log, 4);
+    // New ID 0x123 with two bytes, then the same ID with the second byte changed
+    put8(log, 100);
+    put8(log, 0 << 2 | DELTA_KEY_NEW_ID | DELTA_KEY_NEW_LEN);
+    put8(log, 0xA3); // varint 0x123
+    put8(log, 0x02);
+    put8(log, 2);
+    put8(log, 0x03);
+    put8(log, 0xAA);
+    put8(log, 0xBB);
+    put8(log, 50);
+    put8(log, 0 << 2);
+    put8(log, 0x02);
+    put8(log, 0x0F);
+    MemorySource source(log, 3);
+    FrameReader* reader = openReader(source, "delta");
+
+    CanFrame frame;
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_INT64(100, frame.timestampUs);
+    TEST_ASSERT_EQUAL_HEX32(0x123, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(2, frame.len);
+    TEST_ASSERT_EQUAL_HEX8(0xBB, frame.data[1]);
+
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_INT64(150, frame.timestampUs);
+    TEST_ASSERT_EQUAL_HEX32(0x123, frame.id);
+    TEST_ASSERT_EQUAL_HEX8(0xAA, frame.data[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xB4, frame.data[1]);
+
+    TEST_ASSERT_FALSE(reader->next(frame));
+    delete reader;
+}
+
+static void putPacket(std::string& s, uint32_t itf, uint64_t ts, uint32_t canId, uint8_t len, uint8_t first)
+{
+    put32(s, PCAPNG_EPB);
+    put32(s, 32 + SOCKETCAN_FRAME_SIZE);
+    put32(s, itf);
+    put32(s, ts >> 32);
+    put32(s, (uint32_t)ts);
+    put32(s, SOCKETCAN_FRAME_SIZE);
+    put32(s, SOCKETCAN_FRAME_SIZE);
+    put32(s, __builtin_bswap32(canId)); // network byte order
+    put8(s, len);
+    s.append(3, '\0');
+    for (uint8_t i = 0; i < 8; i++) put8(s, first + i);
+    put32(s, 32 + SOCKETCAN_FRAME_SIZE);
+}
+
+static void test_pcapng_packets()
+{
+    std::string log;
+    put32(log, PCAPNG_SHB);
+    put32(log, 28);
+    put32(log, PCAPNG_BYTE_ORDER);
+    put16(log, 1);
+    put16(log, 0);
+    put64(log, UINT64_MAX);
+    put32(log, 28);
+    // can0 with the default microseconds, can1 in nanoseconds, then an
+    // Ethernet interface whose packets are skipped
+    put32(log, PCAPNG_IDB);
+    put32(log, 20);
+    put16(log, LINKTYPE_CAN_SOCKETCAN);
+    put16(log, 0);
+    put32(log, 0);
+    put32(log, 20);
+    put32(log, PCAPNG_IDB);
+    put32(log, 32);
+    put16(log, LINKTYPE_CAN_SOCKETCAN);
+    put16(log, 0);
+    put32(log, 0);
+    put16(log, PCAPNG_OPT_IF_TSRESOL);
+    put16(log, 1);
+    put32(log, 9);
+    put32(log, PCAPNG_OPT_END);
+    put32(log, 32);
+    put32(log, PCAPNG_IDB);
+    put32(log, 20);
+    put16(log, 1);
+    put16(log, 0);
+    put32(log, 0);
+    put32(log, 20);
+
+    putPacket(log, 0, 1713351000000100ULL, 0x123, 8, 1);
+    putPacket(log, 2, 1713351000000150ULL, 0x456, 8, 1);
+    putPacket(log, 1, 1713351000000200000ULL, 0x80000000UL | 0x18FEF100, 2, 0xF0);
+    putPacket(log, 0, 1713351000000300ULL, 0x40000000UL | 0x7DF, 0, 0);
+    MemorySource source(log, 37);
+    FrameReader* reader = openReader(source, "pcapng");
+
+    CanFrame frame;
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_INT64(1713351000000100LL, frame.timestampUs);
+    TEST_ASSERT_EQUAL_HEX32(0x123, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(0, frame.flags);
+    TEST_ASSERT_EQUAL_UINT8(8, frame.len);
+    TEST_ASSERT_EQUAL_HEX8(8, frame.data[7]);
+
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_INT64(1713351000000200LL, frame.timestampUs);
+    TEST_ASSERT_EQUAL_HEX32(0x18FEF100, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(CAN_FRAME_EXT, frame.flags);
+    TEST_ASSERT_EQUAL_UINT8(2, frame.len);
+    TEST_ASSERT_EQUAL_HEX8(0xF1, frame.data[1]);
+
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_HEX32(0x7DF, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(CAN_FRAME_RTR, frame.flags);
+
+    TEST_ASSERT_FALSE(reader->next(frame));
+    delete reader;
+}
+
+static void putBase2Interface(std::string& s, uint8_t bits)
+{
+    put32(s, PCAPNG_IDB);
+    put32(s, 32);
+    put16(s, LINKTYPE_CAN_SOCKETCAN);
+    put16(s, 0);
+    put32(s, 0);
+    put16(s, PCAPNG_OPT_IF_TSRESOL);
+    put16(s, 1);
+    put32(s, 0x80 | bits);
+    put32(s, PCAPNG_OPT_END);
+    put32(s, 32);
+}
+
+static void test_pcapng_base2_resolution()
+{
+    std::string log;
+    put32(log, PCAPNG_SHB);
+    put32(log, 28);
+    put32(log, PCAPNG_BYTE_ORDER);
+    put16(log, 1);
+    put16(log, 0);
+    put64(log, UINT64_MAX);
+    put32(log, 28);
+    // 2^-10 s ticks, then 2^-64 s, too fine for a 64-bit shift
+    putBase2Interface(log, 10);
+    putBase2Interface(log, 64);
+
+    putPacket(log, 1, 1ULL << 63, 0x456, 8, 1);
+    putPacket(log, 0, 3 * 1024 + 512, 0x123, 8, 1);
+    MemorySource source(log);
+    FrameReader* reader = openReader(source, "pcapng");
+
+    CanFrame frame;
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_HEX32(0x123, frame.id);
+    TEST_ASSERT_EQUAL_INT64(3500000, frame.timestampUs);
+    TEST_ASSERT_FALSE(reader->next(frame));
+    delete reader;
+}
+
+static std::string blfMessage(uint64_t timestamp, uint32_t id, uint8_t dlc, uint8_t first)
+{
+    std::string s = BLF_OBJECT_MAGIC;
+    put16(s, 32);
+    put16(s, 1);
+    put32(s, 48);
+    put32(s, BLF_CAN_MESSAGE);
+    put32(s, 1); // ten microsecond units
+    put16(s, 0);
+    put16(s, 0);
+    put64(s, timestamp);
+    put16(s, 1);
+    put8(s, 0);
+    put8(s, dlc);
+    put32(s, id);
+    for (uint8_t i = 0; i < 8; i++) put8(s, first + i);
+    return s;
+}
+
+static void putContainer(std::string& s, const std::string& payload, uint16_t compression, uint32_t size)
+{
+    s += BLF_OBJECT_MAGIC;
+    put16(s, 16);
+    put16(s, 1);
+    put32(s, 32 + payload.size());
+    put32(s, BLF_LOG_CONTAINER);
+    put16(s, compression);
+    put16(s, 0);
+    put32(s, 0);
+    put32(s, size);
+    put32(s, 0);
+    s += payload;
+}
+
+static void test_blf_containers()
+{
+    std::string log = BLF_FILE_MAGIC;
+    put32(log, 144);
+    log.resize(144);
+
+    // The second message straddles a zlib and a stored container
+    std::string objects = blfMessage(100, 0x123, 8, 1) + blfMessage(250, 0x80000000UL | 0x18FEF100, 3, 0xA0);
+    std::string first = objects.substr(0, 70);
+    uLongf packedSize = compressBound(first.size());
+    std::string packed(packedSize, '\0');
+    TEST_ASSERT_EQUAL_INT(Z_OK, compress((Bytef*)&packed[0], &packedSize, (const Bytef*)first.data(), first.size()));
+    packed.resize(packedSize);
+    putContainer(log, packed, 2, first.size());
+    putContainer(log, objects.substr(70), 0, objects.size() - 70);
+    MemorySource source(log, 61);
+    FrameReader* reader = openReader(source, "blf");
+
+    CanFrame frame;
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_INT64(1000, frame.timestampUs);
+    TEST_ASSERT_EQUAL_HEX32(0x123, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(8, frame.len);
+    TEST_ASSERT_EQUAL_HEX8(8, frame.data[7]);
+
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_INT64(2500, frame.timestampUs);
+    TEST_ASSERT_EQUAL_HEX32(0x18FEF100, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(CAN_FRAME_EXT, frame.flags);
+    TEST_ASSERT_EQUAL_UINT8(3, frame.len);
+    TEST_ASSERT_EQUAL_HEX8(0xA2, frame.data[2]);
+
+    TEST_ASSERT_FALSE(reader->next(frame));
+    delete reader;
+}
+
+static void putBlockHeader(std::string& s, const char* id, uint64_t length, uint64_t links)
+{
+    s += id;
+    put32(s, 0);
+    put64(s, length);
+    put64(s, links);
+}
+
+// Identification, HD, DG, CG and DT blocks as the logger writes them, the
+// links the reader does not follow left 0
+static std::string mf4File(const char* id, uint32_t records, uint32_t written)
+{
+    const uint64_t hd = 64;
+    const uint64_t dg = hd + 24 + MDF_HD_LINKS * 8;
+    const uint64_t cg = dg + 24 + MDF_DG_LINKS * 8 + 8;
+    const uint64_t dt = cg + 24 + MDF_CG_LINKS * 8 + 32;
+
+    std::string s = id;
+    s.resize(hd);
+    putBlockHeader(s, "##HD", dg - hd, MDF_HD_LINKS);
+    put64(s, dg);
+    s.resize(dg);
+    putBlockHeader(s, "##DG", cg - dg, MDF_DG_LINKS);
+    put64(s, 0);
+    put64(s, cg);
+    put64(s, dt);
+    put64(s, 0);
+    put8(s, 0); // no record ID
+    s.resize(cg);
+    putBlockHeader(s, "##CG", dt - cg, MDF_CG_LINKS);
+    s.resize(dt - 8);
+    put32(s, MDF_RECORD_SIZE);
+    put32(s, 0);
+    putBlockHeader(s, "##DT", 24 + records * MDF_RECORD_SIZE, 0);
+    s.resize(dt + 24);
+
+    for (uint32_t i = 0; i < written; i++)
+    {
+        double seconds = 1.5 + i * 0.001;
+        s.append((const char*)&seconds, 8);
+        put8(s, 1);
+        put32(s, i ? 0x80000000UL | (0x18FEF100 + i) : 0x123);
+        put8(s, 8);
+        put8(s, 8);
+        for (uint8_t b = 0; b < 8; b++) put8(s, i + b);
+    }
+    return s;
+}
+
+static void test_mf4_records()
+{
+    // Finalized: the data block length holds three of the four records
+    MemorySource source(mf4File("MDF     ", 3, 4), 509);
+    FrameReader* reader = openReader(source, "mf4");
+
+    CanFrame frame;
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_INT64(1500000, frame.timestampUs);
+    TEST_ASSERT_EQUAL_HEX32(0x123, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(0, frame.flags);
+    TEST_ASSERT_EQUAL_UINT8(8, frame.len);
+    TEST_ASSERT_EQUAL_HEX8(7, frame.data[7]);
+
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_INT64(1501000, frame.timestampUs);
+    TEST_ASSERT_EQUAL_HEX32(0x18FEF101, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(CAN_FRAME_EXT, frame.flags);
+
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_FALSE(reader->next(frame));
+    delete reader;
+}
+
+static void test_mf4_unfinalized()
+{
+    // Cut by a power loss: every whole record up to the end of the file
+    std::string log = mf4File("UnFinMF ", 0, 4);
+    log.resize(log.size() - 5);
+    MemorySource source(log);
+    FrameReader* reader = openReader(source, "mf4");
+
+    CanFrame frame;
+    uint32_t n = 0;
+    while (reader->next(frame)) n++;
+    TEST_ASSERT_EQUAL_UINT32(3, n);
+    delete reader;
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_delta_records);
+    RUN_TEST(test_pcapng_packets);
+    RUN_TEST(test_pcapng_base2_resolution);
+    RUN_TEST(test_blf_containers);
+    RUN_TEST(test_mf4_records);
+    RUN_TEST(test_mf4_unfinalized);
+    return UNITY_END();
+}
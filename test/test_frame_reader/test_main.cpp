@@ -0,0 +1,205 @@
+#include <unity.h>
+#include "candump.h"
+#include "frame_reader.h"
+#include "../mocks/replay_mocks.h"
+
+void setUp() {}
+void tearDown() {}
+
+static std::string candumpLines(uint32_t count)
+{
+    std::string text;
+    char line[CANDUMP_MAX_LINE];
+    for (uint32_t i = 0; i < count; i++)
+    {
+        CanFrame frame = makeFrame(1713351000000000LL + i * 1000, i & 0x7FF);
+        for (uint8_t b = 0; b < 8; b++) frame.data[b] = i + b;
+        text.append(line, formatCandump(frame, line));
+    }
+    return text;
+}
+
+static void test_candump_frames()
+{
+    MemorySource source("(1713351000.000100) can0 123#0102030405060708\n"
+                        "(1713351000.000200) vcan1 18FEF100#FF\r\n"
+                        "not a frame\n"
+                        "(1713351000.000300) can0 7DF#R4\n"
+                        "(1713351000.000400) can0 20000080#0000000000000000\n"
+                        "(1713351000.000500) can0 123##1AABB\n"
+                        "(1713351000.5) can0 456#");
+    FrameReader* reader = openFrameReader(&source);
+    TEST_ASSERT_NOT_NULL(reader);
+    TEST_ASSERT_EQUAL_STRING("candump", reader->name());
+
+    CanFrame frame;
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_INT64(1713351000000100LL, frame.timestampUs);
+    TEST_ASSERT_EQUAL_HEX32(0x123, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(0, frame.flags);
+    TEST_ASSERT_EQUAL_UINT8(8, frame.len);
+    TEST_ASSERT_EQUAL_HEX8(0x08, frame.data[7]);
+
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_HEX32(0x18FEF100, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(CAN_FRAME_EXT, frame.flags);
+    TEST_ASSERT_EQUAL_UINT8(1, frame.len);
+
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_HEX32(0x7DF, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(CAN_FRAME_RTR, frame.flags);
+    TEST_ASSERT_EQUAL_UINT8(4, frame.len);
+
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_UINT8(CAN_FRAME_ERR, frame.flags);
+    TEST_ASSERT_EQUAL_HEX32(0x80, frame.id);
+
+    // The CAN FD line is skipped, the last line has no newline
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_INT64(1713351000500000LL, frame.timestampUs);
+    TEST_ASSERT_EQUAL_HEX32(0x456, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(0, frame.len);
+
+    TEST_ASSERT_FALSE(reader->next(frame));
+    delete reader;
+}
+
+static void test_candump_lines_across_blocks()
+{
+    // Several blocks, handed out in odd sized reads so lines straddle
+    // both the reads and the blocks
+    const uint32_t count = 3 * REPLAY_BLOCK_SIZE / 40;
+    MemorySource source(candumpLines(count), 997);
+    FrameReader* reader = openFrameReader(&source);
+    TEST_ASSERT_NOT_NULL(reader);
+
+    CanFrame frame;
+    uint32_t n = 0;
+    while (reader->next(frame))
+    {
+        TEST_ASSERT_EQUAL_INT64(1713351000000000LL + n * 1000, frame.timestampUs);
+        TEST_ASSERT_EQUAL_HEX32(n & 0x7FF, frame.id);
+        TEST_ASSERT_EQUAL_HEX8((uint8_t)(n + 7), frame.data[7]);
+        n++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(count, n);
+    delete reader;
+}
+
+static void test_candump_overlong_line_dropped()
+{
+    std::string text = "(1.000000) can0 123#01\n";
+    text += std::string(REPLAY_BLOCK_SIZE + REPLAY_MAX_LINE, 'x') + "\n";
+    text += "(2.000000) can0 456#02\n";
+    MemorySource source(text);
+    FrameReader* reader = openFrameReader(&source);
+
+    CanFrame frame;
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_HEX32(0x123, frame.id);
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_HEX32(0x456, frame.id);
+    TEST_ASSERT_FALSE(reader->next(frame));
+    delete reader;
+}
+
+static void test_candump_overlong_line_rest_dropped()
+{
+    // The overlong line fills the first block, the part in the next one
+    // looks like a line of its own and must not come out as a frame
+    std::string text(REPLAY_BLOCK_SIZE, 'x');
+    text += "(1.000000) can0 123#01\n";
+    text += "(2.000000) can0 456#02\n";
+    MemorySource source(text);
+    FrameReader* reader = openFrameReader(&source);
+
+    CanFrame frame;
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_HEX32(0x456, frame.id);
+    TEST_ASSERT_FALSE(reader->next(frame));
+    delete reader;
+}
+
+static void test_ensure_with_short_reads()
+{
+    // A decompressor hands out a little at a time; the buffer fills up to
+    // its capacity and no further
+    std::string text(2 * BLOCK_BUFFER_CAPACITY, 'a');
+    MemorySource source(text, 100);
+    BlockBuffer buffer(&source);
+
+    TEST_ASSERT_EQUAL_UINT32(BLOCK_BUFFER_CAPACITY, buffer.ensure(BLOCK_BUFFER_CAPACITY));
+    TEST_ASSERT_EQUAL_UINT32(BLOCK_BUFFER_CAPACITY, buffer.end - buffer.pos);
+    TEST_ASSERT_FALSE(buffer.fill());
+    TEST_ASSERT_EQUAL_UINT32(0, buffer.ensure(BLOCK_BUFFER_CAPACITY + 1));
+
+    buffer.pos += 1000;
+    TEST_ASSERT_EQUAL_UINT32(BLOCK_BUFFER_CAPACITY, buffer.ensure(BLOCK_BUFFER_CAPACITY));
+    TEST_ASSERT_EQUAL_HEX8('a', buffer.data[BLOCK_BUFFER_CAPACITY - 1]);
+}
+
+static void test_asc_frames()
+{
+    MemorySource source("date Wed Apr 17 10:00:00.000 am 2024\n"
+                        "base hex  timestamps absolute\n"
+                        "Begin Triggerblock Wed Apr 17 10:00:00.000 am 2024\n"
+                        "   0.012345 1  123             Rx   d 8 01 02 03 04 05 06 07 08\n"
+                        "   0.013210 1  18FEF100x       Rx   d 2 FF 00\n"
+                        "   0.014000 1  7DF             Tx   r\n"
+                        "   0.020000 1  ErrorFrame\n"
+                        "End TriggerBlock\n");
+    FrameReader* reader = openFrameReader(&source);
+    TEST_ASSERT_NOT_NULL(reader);
+    TEST_ASSERT_EQUAL_STRING("asc", reader->name());
+
+    CanFrame frame;
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_INT64(12345, frame.timestampUs);
+    TEST_ASSERT_EQUAL_HEX32(0x123, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(8, frame.len);
+
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_HEX32(0x18FEF100, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(CAN_FRAME_EXT, frame.flags);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, frame.data[0]);
+
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_UINT8(CAN_FRAME_RTR, frame.flags);
+
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_UINT8(CAN_FRAME_ERR, frame.flags);
+    TEST_ASSERT_EQUAL_INT64(20000, frame.timestampUs);
+
+    TEST_ASSERT_FALSE(reader->next(frame));
+    delete reader;
+}
+
+static void test_asc_relative_decimal()
+{
+    MemorySource source("base dec  timestamps relative\n"
+                        "   0.001000 1  291             Rx   d 1 255\n"
+                        "   0.000500 1  292             Rx   d 1 16\n");
+    FrameReader* reader = openFrameReader(&source);
+
+    CanFrame frame;
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_HEX32(0x123, frame.id);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, frame.data[0]);
+    TEST_ASSERT_TRUE(reader->next(frame));
+    TEST_ASSERT_EQUAL_INT64(1500, frame.timestampUs);
+    TEST_ASSERT_EQUAL_HEX8(0x10, frame.data[0]);
+    delete reader;
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_candump_frames);
+    RUN_TEST(test_candump_lines_across_blocks);
+    RUN_TEST(test_candump_overlong_line_dropped);
+    RUN_TEST(test_candump_overlong_line_rest_dropped);
+    RUN_TEST(test_ensure_with_short_reads);
+    RUN_TEST(test_asc_frames);
+    RUN_TEST(test_asc_relative_decimal);
+    return UNITY_END();
+}
@@ -0,0 +1,65 @@
+#include <unity.h>
+#include <vector>
+#include "metrics.h"
+#include "reorder_window.h"
+#include "../mocks/replay_mocks.h"
+
+void setUp()
+{
+    metricReset();
+}
+
+void tearDown() {}
+
+static std::vector<CanFrame> reorder(const std::vector<int64_t>& timestamps)
+{
+    static ReorderWindow window;
+    window = ReorderWindow();
+    std::vector<CanFrame> out;
+    CanFrame frame;
+    for (size_t i = 0; i < timestamps.size(); i++)
+    {
+        if (window.push(makeFrame(timestamps[i], i), frame)) out.push_back(frame);
+    }
+    while (window.pop(frame)) out.push_back(frame);
+    return out;
+}
+
+static void test_inversions_are_sorted()
+{
+    // Two interfaces merged with a little skew
+    std::vector<int64_t> in;
+    for (int i = 0; i < 1000; i++) in.push_back(i * 100 + ((i & 1) ? -150 : 0));
+    std::vector<CanFrame> out = reorder(in);
+
+    TEST_ASSERT_EQUAL_UINT32(in.size(), out.size());
+    for (size_t i = 1; i < out.size(); i++) TEST_ASSERT_TRUE(out[i - 1].timestampUs <= out[i].timestampUs);
+    TEST_ASSERT_EQUAL_UINT32(0, metricCount(METRIC_LATE));
+}
+
+static void test_equal_timestamps_keep_file_order()
+{
+    std::vector<CanFrame> out = reorder(std::vector<int64_t>(3 * REORDER_DEPTH, 42));
+    for (size_t i = 0; i < out.size(); i++) TEST_ASSERT_EQUAL_UINT32(i, out[i].id);
+}
+
+static void test_frames_beyond_the_window_are_late()
+{
+    // The last frame is older than everything released before it
+    std::vector<int64_t> in;
+    for (int i = 1; i <= 2 * REORDER_DEPTH; i++) in.push_back(i * 1000);
+    in.push_back(0);
+    std::vector<CanFrame> out = reorder(in);
+
+    TEST_ASSERT_EQUAL_UINT32(in.size(), out.size());
+    TEST_ASSERT_EQUAL_UINT32(1, metricCount(METRIC_LATE));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_inversions_are_sorted);
+    RUN_TEST(test_equal_timestamps_keep_file_order);
+    RUN_TEST(test_frames_beyond_the_window_are_late);
+    return UNITY_END();
+}
@@ -0,0 +1,84 @@
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include "candump.h"
+#include "frame_reader.h"
+#include "metrics.h"
+#include "reorder_window.h"
+#include "replay_engine.h"
+#include "../mocks/replay_mocks.h"
+
+// Host timing of the replay hot path: parse, reorder and schedule. The
+// numbers are for comparing changes on the same machine, not for the ESP32.
+
+#define BENCHMARK_FRAMES 200000
+
+void setUp() {}
+void tearDown() {}
+
+static std::string logText;
+
+static double nsPerFrame(std::chrono::steady_clock::time_point start, uint32_t frames)
+{
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / frames;
+}
+
+static void report(const char* stage, double ns)
+{
+    char message[80];
+    snprintf(message, sizeof(message), "%-8s %8.1f ns/frame", stage, ns);
+    TEST_MESSAGE(message);
+}
+
+static void test_parse()
+{
+    MemorySource source(logText);
+    FrameReader* reader = openFrameReader(&source);
+    CanFrame frame;
+    uint32_t n = 0;
+    auto start = std::chrono::steady_clock::now();
+    while (reader->next(frame)) n++;
+    report("parse", nsPerFrame(start, n));
+    TEST_ASSERT_EQUAL_UINT32(BENCHMARK_FRAMES, n);
+    delete reader;
+}
+
+static void test_pipeline()
+{
+    MemorySource source(logText);
+    FrameReader* reader = openFrameReader(&source);
+    static ReorderWindow window;
+    MockClock clock;
+    MockCan can(clock);
+    can.sent.reserve(BENCHMARK_FRAMES);
+    ReplayEngine engine(can, clock);
+
+    CanFrame frame;
+    CanFrame ordered;
+    auto start = std::chrono::steady_clock::now();
+    while (reader->next(frame))
+    {
+        if (window.push(frame, ordered)) engine.send(ordered);
+    }
+    while (window.pop(ordered)) engine.send(ordered);
+    report("pipeline", nsPerFrame(start, can.sent.size()));
+    TEST_ASSERT_EQUAL_UINT32(BENCHMARK_FRAMES, can.sent.size());
+    delete reader;
+}
+
+int main()
+{
+    char line[CANDUMP_MAX_LINE];
+    for (uint32_t i = 0; i < BENCHMARK_FRAMES; i++)
+    {
+        CanFrame frame = makeFrame(1713351000000000LL + i * 250, (i * 37) & 0x7FF, (i & 7) ? 0 : CAN_FRAME_EXT);
+        for (uint8_t b = 0; b < 8; b++) frame.data[b] = i >> b;
+        logText.append(line, formatCandump(frame, line));
+    }
+
+    UNITY_BEGIN();
+    RUN_TEST(test_parse);
+    RUN_TEST(test_pipeline);
+    return UNITY_END();
+}
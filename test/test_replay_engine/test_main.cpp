@@ -0,0 +1,189 @@
+#include <unity.h>
+#include "metrics.h"
+#include "replay_engine.h"
+#include "../mocks/replay_mocks.h"
+
+void setUp()
+{
+    metricReset();
+}
+
+void tearDown() {}
+
+static void test_frames_follow_log_time_line()
+{
+    MockClock clock;
+    MockCan can(clock);
+    ReplayEngine engine(can, clock);
+
+    const int64_t logged[] = {5000000, 5000000, 5001000, 5004500, 5100000};
+    for (int64_t t : logged) TEST_ASSERT_EQUAL_UINT8(CAN_OK, engine.send(makeFrame(t, 0x100)));
+
+    TEST_ASSERT_EQUAL_UINT32(5, can.sent.size());
+    for (size_t i = 0; i < can.sent.size(); i++)
+    {
+        TEST_ASSERT_EQUAL_INT64(logged[i] - logged[0], can.sent[i].timeUs - can.sent[0].timeUs);
+    }
+    TEST_ASSERT_EQUAL_UINT32(5, metricCount(METRIC_TRANSMITTED));
+    TEST_ASSERT_EQUAL_UINT32(0, metricCount(METRIC_TIMING_ERROR_SUM_US));
+    TEST_ASSERT_EQUAL_UINT32(4, metricCount(METRIC_TIMING_ERROR_COUNT));
+}
+
+static void test_wait_errors_do_not_add_up()
+{
+    // Every send takes 300 us and every sleep wakes 200 us late, with a 1 ms
+    // sleep resolution. Against the absolute schedule the deviation stays
+    // bounded instead of growing with each frame.
+    MockClock clock;
+    clock.resolutionUs = 1000;
+    clock.latencyUs = 200;
+    MockCan can(clock);
+    can.costUs = 300;
+    ReplayEngine engine(can, clock);
+
+    for (int i = 0; i < 1000; i++) engine.send(makeFrame(i * 2500LL, 0x200));
+
+    int64_t start = can.sent[0].timeUs;
+    for (size_t i = 0; i < can.sent.size(); i++)
+    {
+        int64_t deviation = can.sent[i].timeUs - start - (int64_t)i * 2500;
+        TEST_ASSERT_TRUE(deviation > -1000 && deviation < 1000);
+    }
+    LogHistogram h;
+    metricHistogram(HIST_SCHEDULE_DEVIATION, h);
+    TEST_ASSERT_EQUAL_UINT32(1000, h.count);
+    TEST_ASSERT_TRUE(h.max < 1000);
+}
+
+static void test_late_frames_are_sent_at_once()
+{
+    MockClock clock;
+    MockCan can(clock);
+    can.costUs = 2500; // slower than the log, within REPLAY_MAX_BEHIND_US
+    ReplayEngine engine(can, clock);
+
+    for (int i = 0; i < 10; i++) engine.send(makeFrame(i * 1000LL, 0x300));
+
+    TEST_ASSERT_EQUAL_UINT32(0, clock.sleeps);
+    TEST_ASSERT_EQUAL_INT64(9 * 2500, can.sent[9].timeUs - can.sent[0].timeUs);
+    LogHistogram h;
+    metricHistogram(HIST_SCHEDULE_DEVIATION, h);
+    // Deviation is taken once the controller has the frame
+    TEST_ASSERT_EQUAL_UINT32(9 * 1500 + 2500, h.max);
+    TEST_ASSERT_EQUAL_UINT32(0, metricCount(METRIC_EARLY));
+    TEST_ASSERT_EQUAL_UINT32(0, metricCount(METRIC_REANCHORS));
+}
+
+static void test_stall_reanchors_schedule()
+{
+    // A busy controller holds one frame for 40 ms. The frames after it keep
+    // their logged gaps instead of going out back to back.
+    MockClock clock;
+    MockCan can(clock);
+    ReplayEngine engine(can, clock);
+
+    engine.send(makeFrame(0, 0x380));
+    can.busy = 4;
+    engine.send(makeFrame(1000, 0x380));
+    for (int i = 2; i < 10; i++) engine.send(makeFrame(i * 1000LL, 0x380));
+
+    TEST_ASSERT_EQUAL_UINT32(10, can.sent.size());
+    TEST_ASSERT_EQUAL_INT64(1000 + 4 * REPLAY_BUSY_WAIT_US, can.sent[1].timeUs - can.sent[0].timeUs);
+    for (size_t i = 3; i < can.sent.size(); i++)
+    {
+        TEST_ASSERT_EQUAL_INT64(1000, can.sent[i].timeUs - can.sent[i - 1].timeUs);
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, metricCount(METRIC_REANCHORS));
+}
+
+static void test_inversion_does_not_shift_schedule()
+{
+    // A frame 30 ms older than the one before is sent at once; the frames
+    // after it stay on the time line
+    MockClock clock;
+    MockCan can(clock);
+    ReplayEngine engine(can, clock);
+
+    const int64_t logged[] = {100000, 101000, 71000, 102000, 103000};
+    for (int64_t t : logged) engine.send(makeFrame(t, 0x390));
+
+    TEST_ASSERT_EQUAL_UINT32(5, can.sent.size());
+    TEST_ASSERT_EQUAL_INT64(1000, can.sent[1].timeUs - can.sent[0].timeUs);
+    TEST_ASSERT_EQUAL_INT64(can.sent[1].timeUs, can.sent[2].timeUs);
+    TEST_ASSERT_EQUAL_INT64(2000, can.sent[3].timeUs - can.sent[0].timeUs);
+    TEST_ASSERT_EQUAL_INT64(3000, can.sent[4].timeUs - can.sent[0].timeUs);
+    TEST_ASSERT_EQUAL_UINT32(0, metricCount(METRIC_REANCHORS));
+    TEST_ASSERT_EQUAL_UINT32(0, metricCount(METRIC_TIMING_ERROR_SUM_US));
+}
+
+static void test_early_frames_are_counted()
+{
+    // A coarse clock wakes up to almost a millisecond before the frame's time
+    MockClock clock;
+    clock.resolutionUs = 1000;
+    MockCan can(clock);
+    ReplayEngine engine(can, clock);
+
+    engine.send(makeFrame(0, 0x400));
+    engine.send(makeFrame(1500, 0x400));
+
+    TEST_ASSERT_EQUAL_INT64(1000, can.sent[1].timeUs - can.sent[0].timeUs);
+    TEST_ASSERT_EQUAL_UINT32(1, metricCount(METRIC_EARLY));
+    TEST_ASSERT_EQUAL_UINT32(500, metricCount(METRIC_TIMING_ERROR_SUM_US));
+}
+
+static void test_busy_controller_is_retried()
+{
+    MockClock clock;
+    MockCan can(clock);
+    can.busy = REPLAY_TX_ATTEMPTS - 1;
+    ReplayEngine engine(can, clock);
+
+    int64_t start = clock.now;
+    TEST_ASSERT_EQUAL_UINT8(CAN_OK, engine.send(makeFrame(0, 0x500)));
+    TEST_ASSERT_EQUAL_UINT32(REPLAY_TX_ATTEMPTS, can.attempts);
+    TEST_ASSERT_EQUAL_UINT32(1, can.sent.size());
+    TEST_ASSERT_EQUAL_INT64((REPLAY_TX_ATTEMPTS - 1) * REPLAY_BUSY_WAIT_US, can.sent[0].timeUs - start);
+}
+
+static void test_busy_controller_gives_up()
+{
+    MockClock clock;
+    MockCan can(clock);
+    can.busy = REPLAY_TX_ATTEMPTS;
+    ReplayEngine engine(can, clock);
+
+    TEST_ASSERT_EQUAL_UINT8(CAN_GETTXBFTIMEOUT, engine.send(makeFrame(0, 0x600)));
+    TEST_ASSERT_EQUAL_UINT32(REPLAY_TX_ATTEMPTS, can.attempts);
+    TEST_ASSERT_EQUAL_UINT32(0, can.sent.size());
+    TEST_ASSERT_EQUAL_UINT32(0, metricCount(METRIC_TRANSMITTED));
+
+    // The next frame goes out normally
+    TEST_ASSERT_EQUAL_UINT8(CAN_OK, engine.send(makeFrame(1000, 0x600)));
+}
+
+static void test_errors_are_not_retried()
+{
+    MockClock clock;
+    MockCan can(clock);
+    can.failStatus = CAN_FAIL;
+    ReplayEngine engine(can, clock);
+
+    TEST_ASSERT_EQUAL_UINT8(CAN_FAIL, engine.send(makeFrame(0, 0x700)));
+    TEST_ASSERT_EQUAL_UINT32(1, can.attempts);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_frames_follow_log_time_line);
+    RUN_TEST(test_wait_errors_do_not_add_up);
+    RUN_TEST(test_late_frames_are_sent_at_once);
+    RUN_TEST(test_stall_reanchors_schedule);
+    RUN_TEST(test_inversion_does_not_shift_schedule);
+    RUN_TEST(test_early_frames_are_counted);
+    RUN_TEST(test_busy_controller_is_retried);
+    RUN_TEST(test_busy_controller_gives_up);
+    RUN_TEST(test_errors_are_not_retried);
+    return UNITY_END();
+}
@@ -0,0 +1,94 @@
+import argparse
+import sys
+
+MAGIC = b'CDL1'
+NEW_ID = 0x02
+NEW_LEN = 0x01
+
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        b = data[pos]
+        pos += 1
+        value |= (b & 0x7F) << shift
+        if not b & 0x80:
+            return value, pos
+        shift += 7
+
+def decode(data):
+    """
+    Yields (timestamp_us, id, flags, payload) for every record of a .cdl log.
+    """
+    if data[:4] != MAGIC or data[4] != 1:
+        raise ValueError("not a CDL1 log")
+    capacity = data[6] | data[7] << 8
+    entries = {}
+    timestamp = 0
+    pos = 8
+    while pos < len(data):
+        try:
+            delta, pos = read_varint(data, pos)
+            key, pos = read_varint(data, pos)
+            index = key >> 2
+            if index == capacity:
+                entry = [0, 0, bytearray(8)]
+            else:
+                entry = entries.setdefault(index, [0, 0, bytearray(8)])
+            if key & NEW_ID:
+                entry[0], pos = read_varint(data, pos)
+                entry[1] = 0
+                entry[2] = bytearray(8)
+            if key & NEW_LEN:
+                for i in range(entry[1], 8):
+                    entry[2][i] = 0
+                entry[1] = data[pos]
+                pos += 1
+            mask = data[pos]
+            pos += 1
+            for i in range(entry[1]):
+                if mask & (1 << i):
+                    entry[2][i] ^= data[pos]
+                    pos += 1
+        except IndexError:
+            break  # record cut short by a power loss
+        timestamp += delta
+        yield timestamp, entry[0] & 0x1FFFFFFF, entry[0] >> 29, bytes(entry[2][:entry[1]])
+
+def format_line(timestamp, can_id, flags, payload):
+    if flags & 0x04:
+        id_str = f"{can_id | 0x20000000:08X}"
+    elif flags & 0x01:
+        id_str = f"{can_id:08X}"
+    else:
+        id_str = f"{can_id:03X}"
+    data = "R" if flags & 0x02 else payload.hex().upper()
+    return f"({timestamp // 1000000}.{timestamp % 1000000:06d}) can0 {id_str}#{data}\n"
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a compact binary (.cdl) log to candump format.')
+    parser.add_argument('input', help='Input .cdl filename')
+    parser.add_argument('output', help='Output log filename')
+
+    args = parser.parse_args()
+
+    try:
+        with open(args.input, 'rb') as f:
+            data = f.read()
+    except FileNotFoundError:
+        print(f"Error: File {args.input} not found.", file=sys.stderr)
+        sys.exit(1)
+
+    count = 0
+    try:
+        with open(args.output, 'w') as outfile:
+            for record in decode(data):
+                outfile.write(format_line(*record))
+                count += 1
+    except ValueError as e:
+        print(f"Error: {e}", file=sys.stderr)
+        sys.exit(1)
+    print(f"Decoded {count} frames to {args.output}")
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,55 @@
+import argparse
+import struct
+import sys
+
+BLOCK_MAGIC = 0x32425246  # "FRB2"
+HEADER = struct.Struct('<IIIHHI')
+
+def read_blocks(input_file, block_size):
+    """
+    Yields (sequence, payload) for every valid block of a flight recorder ring file.
+    Blocks of another epoch than block 0 are left over from an earlier ring.
+    """
+    ring_epoch = None
+    with open(input_file, 'rb') as f:
+        while True:
+            block = f.read(block_size)
+            if len(block) < HEADER.size:
+                break
+            magic, epoch, sequence, used, frames, check = HEADER.unpack_from(block)
+            valid = magic == BLOCK_MAGIC and sequence != 0 and check == magic ^ epoch ^ sequence ^ ((used << 16) | frames)
+            if ring_epoch is None:
+                if not valid:
+                    return
+                ring_epoch = epoch
+            if not valid or epoch != ring_epoch:
+                continue
+            yield sequence, block[HEADER.size:HEADER.size + used]
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a flight recorder ring file to a candump log.')
+    parser.add_argument('input', help='Ring file copied from the SD card (rec/flight.bin)')
+    parser.add_argument('output', help='Output log filename')
+    parser.add_argument('-block', type=int, default=4096, help='FLIGHT_BLOCK_SIZE the firmware was built with')
+
+    args = parser.parse_args()
+
+    try:
+        blocks = sorted(read_blocks(args.input, args.block))
+    except FileNotFoundError:
+        print(f"Error: File {args.input} not found.", file=sys.stderr)
+        sys.exit(1)
+
+    if not blocks:
+        print("Error: No recorded blocks found.", file=sys.stderr)
+        sys.exit(1)
+
+    with open(args.output, 'wb') as outfile:
+        for _, payload in blocks:
+            outfile.write(payload)
+
+    gaps = sum(1 for a, b in zip(blocks, blocks[1:]) if b[0] != a[0] + 1)
+    print(f"Extracted blocks {blocks[0][0]}..{blocks[-1][0]} ({len(blocks)} blocks, {gaps} gaps) to {args.output}")
+
+if __name__ == "__main__":
+    main()
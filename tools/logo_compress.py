@@ -0,0 +1,102 @@
+import argparse
+import re
+import struct
+import sys
+
+MAX_LITERAL = 128  # control byte 0..127: 1..128 literal pixels follow
+MAX_RUN = 129      # control byte 128..255: one pixel repeated 2..129 times
+
+def read_pixels(header_file):
+    """
+    Returns the RGB565 pixels of a C array header as a list of 16 bit values,
+    in the byte order the array holds them.
+    """
+    with open(header_file, 'r') as f:
+        text = f.read()
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    body = text[text.index('{') + 1:text.rindex('}')]
+    data = bytes(int(v, 16) for v in re.findall(r'0[xX][0-9a-fA-F]+', body))
+    if len(data) % 2:
+        sys.exit('Odd number of bytes in image array')
+    return list(struct.unpack('<%dH' % (len(data) // 2), data))
+
+def encode(pixels):
+    """
+    PackBits style run-length coding on 16 bit pixels.
+    """
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            del literal[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(struct.pack('<H', p))
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < MAX_RUN and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            flush_literal()
+            out.append(128 + run - 2)
+            out += struct.pack('<H', pixels[i])
+            i += run
+        else:
+            literal.append(pixels[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+def decode(data, count):
+    pixels = []
+    i = 0
+    while len(pixels) < count:
+        c = data[i]
+        i += 1
+        if c < 128:
+            for _ in range(c + 1):
+                pixels.append(struct.unpack_from('<H', data, i)[0])
+                i += 2
+        else:
+            pixels += [struct.unpack_from('<H', data, i)[0]] * (c - 126)
+            i += 2
+    return pixels
+
+def main():
+    parser = argparse.ArgumentParser(description='Run-length compress the splash image for the firmware.')
+    parser.add_argument('input', help='Uncompressed image header (include/m5_logo.h)')
+    parser.add_argument('output', help='Compressed image header (include/m5_logo_rle.h)')
+    parser.add_argument('-width', type=int, default=320, help='Image width in pixels')
+    parser.add_argument('-height', type=int, default=240, help='Image height in pixels')
+    parser.add_argument('-name', default='gImage_logoM5_rle', help='Name of the generated array')
+
+    args = parser.parse_args()
+
+    pixels = read_pixels(args.input)
+    if len(pixels) != args.width * args.height:
+        sys.exit('Image has %d pixels, expected %dx%d' % (len(pixels), args.width, args.height))
+
+    data = encode(pixels)
+    if decode(data, len(pixels)) != pixels:
+        sys.exit('Round trip check failed')
+
+    with open(args.output, 'w') as f:
+        f.write('#pragma once\n')
+        f.write('#include <stdint.h>\n\n')
+        f.write('// Generated by tools/logo_compress.py from %s, do not edit.\n' % args.input.split('/')[-1])
+        f.write('// %dx%d RGB565, %d bytes run-length coded from %d.\n\n' % (args.width, args.height, len(data), len(pixels) * 2))
+        f.write('#define LOGO_WIDTH %d\n' % args.width)
+        f.write('#define LOGO_HEIGHT %d\n\n' % args.height)
+        f.write('const uint8_t %s[%d] = {\n' % (args.name, len(data)))
+        for k in range(0, len(data), 16):
+            f.write('    ' + ', '.join('0x%02X' % b for b in data[k:k + 16]) + ',\n')
+        f.write('};\n')
+
+    print('%d bytes -> %d bytes (%.1f%%)' % (len(pixels) * 2, len(data), 100.0 * len(data) / (len(pixels) * 2)))
+
+if __name__ == '__main__':
+    main()
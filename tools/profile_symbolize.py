@@ -0,0 +1,159 @@
+import argparse
+import bisect
+import glob
+import os
+import re
+import shutil
+import subprocess
+import sys
+from collections import Counter
+
+DEFAULT_ELF = '.pio/build/m5stack-core2/firmware.elf'
+NM = 'xtensa-esp32-elf-nm'
+INTERRUPT = '(interrupt)'
+UNKNOWN = '(unknown)'
+
+def read_dump(input_file):
+    """
+    Returns (hz, {handle: name}, {core: [(pc, caller, task), ...]}) for the
+    last complete "profile" dump in a serial capture.
+    """
+    dump = None
+    current = None
+    with open(input_file, 'rb') as f:
+        # Telemetry messages are framed by zero bytes and may sit between
+        # the lines of a dump
+        text = re.sub(rb'\x00[^\x00]*\x00', b'', f.read()).decode('utf-8', errors='replace')
+        for line in text.splitlines():
+            fields = line.split()
+            if not fields:
+                continue
+            if fields[0] == 'profile' and len(fields) == 4 and fields[1] == 'begin':
+                current = (int(fields[2]), {}, {})
+                core = None
+            elif current is None:
+                continue
+            elif fields[0] == 'profile' and len(fields) == 2 and fields[1] == 'end':
+                dump = current
+                current = None
+            elif fields[0] == 'task' and len(fields) >= 3:
+                current[1][int(fields[1], 16)] = ' '.join(fields[2:])
+            elif fields[0] == 'core' and len(fields) == 3:
+                core = int(fields[1])
+                current[2][core] = []
+            elif len(fields) == 3 and core is not None:
+                try:
+                    current[2][core].append(tuple(int(x, 16) for x in fields))
+                except ValueError:
+                    pass
+    return dump
+
+def find_nm(nm):
+    """
+    The toolchain nm from PATH or from the PlatformIO packages.
+    """
+    if nm:
+        return nm
+    if shutil.which(NM):
+        return NM
+    packages = os.path.expanduser('~/.platformio/packages')
+    found = glob.glob(os.path.join(packages, 'toolchain-xtensa*', 'bin', NM))
+    return found[0] if found else NM
+
+class SymbolTable:
+    """
+    Function start addresses of the ELF, sorted, and their names.
+    """
+    def __init__(self, lines):
+        symbols = {}
+        for line in lines:
+            fields = line.split(None, 3)
+            if len(fields) < 4 or fields[2] not in 'tTwW':
+                continue
+            try:
+                address, size = int(fields[0], 16), int(fields[1], 16)
+            except ValueError:
+                continue
+            symbols[address] = (address + size, fields[3].strip())
+        self.starts = sorted(symbols)
+        self.ends = [symbols[a][0] for a in self.starts]
+        self.names = [symbols[a][1] for a in self.starts]
+
+    @classmethod
+    def from_elf(cls, elf, nm):
+        out = subprocess.run([nm, '-n', '-S', '-C', '--defined-only', elf],
+                             check=True, capture_output=True, text=True).stdout
+        return cls(out.splitlines())
+
+    def lookup(self, address):
+        i = bisect.bisect_right(self.starts, address) - 1
+        if i < 0 or address >= self.ends[i]:
+            return UNKNOWN
+        return self.names[i]
+
+def percent(n, total):
+    return f'{100.0 * n / total:6.2f}%' if total else '   -  '
+
+def print_table(title, counts, total, limit):
+    print(title)
+    for name, n in counts.most_common(limit):
+        print(f'  {n:8d} {percent(n, total)}  {name}')
+    print()
+
+def report(hz, tasks, cores, symbols, limit):
+    for core, samples in sorted(cores.items()):
+        total = len(samples)
+        print(f'Core {core}: {total} samples, {total / hz:.2f} s at {hz} Hz')
+        print()
+        functions = Counter()
+        sites = Counter()
+        by_task = Counter()
+        for pc, caller, task in samples:
+            task_name = tasks.get(task, f'{task:08x}')
+            if pc == 0:
+                functions[INTERRUPT] += 1
+                by_task[f'{task_name}  {INTERRUPT}'] += 1
+                continue
+            function = symbols.lookup(pc)
+            functions[function] += 1
+            sites[f'{symbols.lookup(caller)} -> {function}'] += 1
+            by_task[f'{task_name}  {function}'] += 1
+        print_table('  Functions', functions, total, limit)
+        print_table('  Call sites', sites, total, limit)
+        print_table('  Tasks', Counter(tasks.get(t, f'{t:08x}') for _, _, t in samples), total, limit)
+        print_table('  Functions by task', by_task, total, limit)
+
+def main():
+    parser = argparse.ArgumentParser(description='Symbolize a "profile" serial dump against the firmware ELF.')
+    parser.add_argument('input', help='Serial capture containing the output of the "profile" command')
+    parser.add_argument('-elf', default=DEFAULT_ELF, help=f'Firmware ELF (default {DEFAULT_ELF})')
+    parser.add_argument('-nm', help=f'nm of the toolchain (default {NM} from PATH or PlatformIO)')
+    parser.add_argument('-top', type=int, default=20, help='Rows per table (default 20)')
+
+    args = parser.parse_args()
+
+    try:
+        dump = read_dump(args.input)
+    except FileNotFoundError:
+        print(f"Error: File {args.input} not found.", file=sys.stderr)
+        sys.exit(1)
+
+    if dump is None:
+        print("Error: No complete profile dump found.", file=sys.stderr)
+        sys.exit(1)
+
+    if not os.path.exists(args.elf):
+        print(f"Error: File {args.elf} not found.", file=sys.stderr)
+        sys.exit(1)
+
+    try:
+        symbols = SymbolTable.from_elf(args.elf, find_nm(args.nm))
+    except (OSError, subprocess.CalledProcessError) as e:
+        print(f"Error: Could not read the symbols of {args.elf}: {e}", file=sys.stderr)
+        sys.exit(1)
+
+    hz, tasks, cores = dump
+    report(hz, tasks, cores, symbols, args.top)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,216 @@
+import argparse
+import struct
+import sys
+
+# TelemetryType, TelemetryCounter, TelemetryHistogramId,
+# TelemetryEventCode and the event details in include/telemetry.h
+COUNTERS, HISTOGRAM, EVENT, TASKS = 1, 2, 3, 4
+COUNTER_NAMES = ['uptime_ms', 'free_heap', 'received', 'dropped', 'filtered', 'unchanged',
+                 'transmitted', 'late', 'early', 'timing_error_sum_us', 'timing_error_count',
+                 'lz4_blocks', 'lz4_in_bytes', 'lz4_out_bytes', 'lz4_micros', 'events_dropped',
+                 'heap_largest', 'heap_min_free', 'psram_free', 'psram_largest', 'psram_min_free',
+                 'stack_free_min', 'cpu0_permille', 'cpu1_permille', 'reanchors']
+UNKNOWN = 0xFFFF
+HISTOGRAM_NAMES = ['schedule deviation us', 'stage read', 'stage parse', 'stage wait',
+                   'stage spi load', 'stage tx done']
+EVENT_TX_ERROR, EVENT_BOOT, EVENT_FIRST_FRAME, EVENT_ID_FILTER = 1, 2, 3, 11
+MCP_STATUS = {2: 'fail TX', 5: 'controller error', 6: 'TX buffer full (no ACK?)', 7: 'send timeout'}
+BOOT_PHASES = ['display', 'splash', 'SD', 'scan', 'CAN', 'ready']
+# Code -> (subject, texts by detail); {} in a text takes the argument
+EVENT_TEXTS = {
+    4: ('replay', ['found a file of {} bytes', 'cannot decode the file', 'cannot parse the file',
+                   'transmission started', 'finished, {} frames transmitted',
+                   'could not open the timing report']),
+    5: ('recording', ['to log file {}', 'could not open the log file', 'stopped']),
+    6: ('trigger', ['armed, {} ms pre-trigger', 'fired by a frame, flushing {} buffered frames',
+                    'fired by an error frame, flushing {} buffered frames',
+                    'fired by the button, flushing {} buffered frames', 'capture complete, re-armed',
+                    'capture overrun, {} frames lost']),
+    7: ('flight recorder', ['created a ring of {} MB', 'resuming at block {}']),
+    8: ('MF4', ['could not open the next file, recording stopped', '{} remote/error frames not stored',
+                '{} frames lost after a file error']),
+    9: ('source', ['LZ4 blocks of {} KB not supported, compress with lz4 -B4 or -B5', 'LZ4 corrupt block',
+                   'gzip inflate error {signed}']),
+    10: ('reader', ['MF4 file not written by this logger', 'BLF container of {} bytes too large',
+                    'BLF container inflate failed ({signed})']),
+    12: ('unavailable', ['change filter, no internal RAM for the table', 'trigger capture, no PSRAM for the ring',
+                         'trace buffer, no PSRAM', 'sampling profiler, no PSRAM', 'CPU load, no idle hooks']),
+    13: ('power off', ['BtnA pressed']),
+}
+ID_FILTER_TEXTS = ['{std} standard, {ext} extended IDs', 'could not build the extended ID hash',
+                   'RXB0 mask {:08X}', 'RXB1 mask {:08X}', '{} IDs pass the masks']
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+def bucket_limit(bucket):
+    """Largest value in a LogHistogram bucket"""
+    if bucket < 4:
+        return bucket
+    octave = bucket // 4 + 1
+    base = 1 << octave
+    return base + (bucket % 4 + 1) * (base >> 2) - 1
+
+def quantile(buckets, count, maximum, per_mille):
+    rank = count - count * (1000 - per_mille) // 1000
+    seen = 0
+    for bucket, n in buckets:
+        seen += n
+        if seen >= rank:
+            return min(bucket_limit(bucket), maximum)
+    return maximum
+
+def format_counters(payload):
+    mode, n = payload[0], payload[1]
+    values = struct.unpack_from(f'<{n}Q', payload, 2)
+    fields = []
+    for i, value in enumerate(values):
+        name = COUNTER_NAMES[i] if i < len(COUNTER_NAMES) else f'counter{i}'
+        fields.append(f'{name}={value}')
+    return f"counters {'record' if mode else 'replay'} " + ' '.join(fields)
+
+def format_histogram(payload):
+    hid, count, minimum, maximum, total, n = struct.unpack_from('<BIIIQB', payload)
+    buckets = [struct.unpack_from('<BI', payload, 22 + 5 * i) for i in range(n)]
+    name = HISTOGRAM_NAMES[hid] if hid < len(HISTOGRAM_NAMES) else f'histogram{hid}'
+    p = [quantile(buckets, count, maximum, pm) for pm in (500, 990, 999)]
+    return (f'histogram {name}: count={count} min={minimum} mean={total / count:.1f} '
+            f'p50={p[0]} p99={p[1]} p99.9={p[2]} max={maximum}')
+
+def format_event(payload):
+    time_ms, code, detail, arg = struct.unpack_from('<IBBI', payload)
+    signed = arg - (1 << 32) if arg & 0x80000000 else arg
+    if code == EVENT_TX_ERROR:
+        can_id = f'{arg & 0x1FFFFFFF:08X}' if arg & 0x80000000 else f'{arg:03X}'
+        text = f'TX error {MCP_STATUS.get(detail, detail)}, ID {can_id}'
+    elif code == EVENT_BOOT and detail < len(BOOT_PHASES):
+        text = f'boot {BOOT_PHASES[detail]} done at {arg} ms'
+    elif code == EVENT_FIRST_FRAME:
+        text = f"first frame at {arg} ms{', over BOOT_TARGET_MS' if detail else ''}"
+    elif code == EVENT_ID_FILTER and detail < len(ID_FILTER_TEXTS):
+        text = 'ID filter: ' + ID_FILTER_TEXTS[detail].format(arg, std=arg & 0xFFFF, ext=arg >> 16)
+    elif code in EVENT_TEXTS and detail < len(EVENT_TEXTS[code][1]):
+        subject, texts = EVENT_TEXTS[code]
+        text = f'{subject}: ' + texts[detail].format(arg, signed=signed)
+    else:
+        text = f'event {code} detail={detail} arg={arg:#x}'
+    return f'event {time_ms / 1000:.3f} s: {text}'
+
+def format_tasks(payload):
+    n = payload[0]
+    lines = ['tasks        name core  cpu %  stack free']
+    for i in range(n):
+        name, core, cpu, stack = struct.unpack_from('<16sBHI', payload, 1 + 23 * i)
+        name = name.split(b'\0')[0].decode('utf-8', errors='replace')
+        core = '-' if core == 0xFF else core
+        cpu = '    -' if cpu == UNKNOWN else f'{cpu / 10:5.1f}'
+        lines.append(f'{name:>16} {core:>4} {cpu:>6} {stack:>11}')
+    return '\n'.join(lines)
+
+def decode_message(chunk):
+    """
+    Returns (sequence, text) for a valid frame, None otherwise
+    """
+    message = cobs_decode(chunk)
+    if message is None or len(message) < 4:
+        return None
+    body, crc = message[:-2], struct.unpack('<H', message[-2:])[0]
+    if crc16(body) != crc:
+        return None
+    kind, sequence, payload = body[0], body[1], body[2:]
+    try:
+        if kind == COUNTERS:
+            return sequence, format_counters(payload)
+        if kind == HISTOGRAM:
+            return sequence, format_histogram(payload)
+        if kind == EVENT:
+            return sequence, format_event(payload)
+        if kind == TASKS:
+            return sequence, format_tasks(payload)
+    except struct.error:
+        return None
+    return sequence, f'message type {kind}: {payload.hex()}'
+
+def chunks(stream):
+    """
+    Yields the bytes between zero delimiters
+    """
+    pending = bytearray()
+    while True:
+        data = stream.read(1024) if not hasattr(stream, 'in_waiting') else stream.read(max(1, stream.in_waiting))
+        if not data:
+            break
+        for byte in data:
+            if byte == 0:
+                yield bytes(pending)
+                pending.clear()
+            else:
+                pending.append(byte)
+    if pending:
+        yield bytes(pending)
+
+def open_input(path, baud):
+    if path.startswith('/dev/') or path.upper().startswith('COM'):
+        try:
+            import serial
+        except ImportError:
+            print("Error: reading a serial port needs pyserial (pip install pyserial).", file=sys.stderr)
+            sys.exit(1)
+        return serial.Serial(path, baud)
+    return open(path, 'rb')
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode the binary telemetry of the CAN logger.')
+    parser.add_argument('input', help='Serial port (e.g. /dev/ttyUSB0) or a raw capture file')
+    parser.add_argument('-baud', type=int, default=921600, help='TELEMETRY_BAUD the firmware was built with')
+    parser.add_argument('-quiet', action='store_true', help='Drop the text output between messages')
+
+    args = parser.parse_args()
+
+    try:
+        stream = open_input(args.input, args.baud)
+    except (FileNotFoundError, OSError) as e:
+        print(f"Error: {e}", file=sys.stderr)
+        sys.exit(1)
+
+    expected = None
+    try:
+        for chunk in chunks(stream):
+            if not chunk:
+                continue
+            decoded = decode_message(chunk)
+            if decoded is None:
+                # Replies of serial commands
+                text = chunk.decode('utf-8', errors='replace').rstrip()
+                if text and not args.quiet:
+                    print(text)
+                continue
+            sequence, text = decoded
+            if expected is not None and sequence != expected:
+                print(f'-- {(sequence - expected) & 0xFF} messages lost')
+            expected = (sequence + 1) & 0xFF
+            print(text, flush=True)
+    except KeyboardInterrupt:
+        pass
+
+if __name__ == "__main__":
+    main()
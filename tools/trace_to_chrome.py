@@ -0,0 +1,148 @@
+import argparse
+import json
+import re
+import sys
+
+# TraceEvent and TraceTask in include/trace_buffer.h
+TASK_RUN, TASK_WAIT, ISR, SD_READ_BEGIN, SD_READ_END, SD_SYNC_BEGIN, SD_SYNC_END, TX_START, TX_FREE = range(9)
+TASK_NAMES = ['loop', 'CANReceive', 'LogWriter', 'LogReader', 'CANTransmit', 'StatusUI']
+
+ISR_TID = 100   # + core
+CORE_TID = 200  # + core, events before the first task switch of a core
+BUS_TID = 300
+
+def read_dump(input_file):
+    """
+    Returns (now_us, {core: [(time_low32, event, arg), ...]}) for the last
+    complete "trace" dump in a serial capture.
+    """
+    dump = None
+    current = None
+    with open(input_file, 'rb') as f:
+        # Telemetry messages are framed by zero bytes and may sit between
+        # the lines of a dump
+        text = re.sub(rb'\x00[^\x00]*\x00', b'', f.read()).decode('utf-8', errors='replace')
+        for line in text.splitlines():
+            fields = line.split()
+            if not fields:
+                continue
+            if fields[0] == 'trace' and len(fields) == 4 and fields[1] == 'begin':
+                current = (int(fields[3]), {})
+                core = None
+            elif current is None:
+                continue
+            elif fields[0] == 'trace' and len(fields) == 2 and fields[1] == 'end':
+                dump = current
+                current = None
+            elif fields[0] == 'core' and len(fields) == 3:
+                core = int(fields[1])
+                current[1][core] = []
+            elif len(fields) == 3 and core is not None:
+                try:
+                    current[1][core].append((int(fields[0], 16), int(fields[1], 16), int(fields[2], 16)))
+                except ValueError:
+                    pass
+    return dump
+
+def unwrap(low, now_us):
+    """
+    Full microsecond time of a record: the latest time not after the dump
+    with the same low 32 bits.
+    """
+    full = (now_us & ~0xFFFFFFFF) | low
+    if full > now_us:
+        full -= 1 << 32
+    return full
+
+def can_id(arg):
+    return f'{arg & 0x1FFFFFFF:08X}' if arg & 0x80000000 else f'{arg:03X}'
+
+def convert(now_us, cores):
+    events = [{'ph': 'M', 'pid': 0, 'name': 'process_name', 'args': {'name': 'M5Core CAN logger'}}]
+    tids = set()
+
+    def emit(tid, **event):
+        tids.add(tid)
+        event.update(pid=0, tid=tid)
+        events.append(event)
+
+    tx_id = 0
+    for core, records in sorted(cores.items()):
+        if not records:
+            continue
+        first = unwrap(records[0][0], now_us)
+        running = None   # task of the last switch on this core
+        open_run = set() # tasks with an open run span
+        tx_name = None
+        t = first
+        for low, event, arg in records:
+            t = unwrap(low, now_us)
+            tid = running + 1 if running is not None else CORE_TID + core
+            if event == TASK_RUN:
+                running = arg
+                emit(arg + 1, ph='B', ts=t, name='run', args={'core': core})
+                open_run.add(arg)
+            elif event == TASK_WAIT:
+                if arg not in open_run:
+                    # The run began before the oldest record
+                    emit(arg + 1, ph='B', ts=first, name='run', args={'core': core})
+                emit(arg + 1, ph='E', ts=t)
+                open_run.discard(arg)
+                running = None
+            elif event == ISR:
+                emit(ISR_TID + core, ph='i', s='t', ts=t, name='CAN interrupt')
+            elif event == SD_READ_BEGIN:
+                emit(tid, ph='B', ts=t, name='SD read', args={'requested': arg})
+            elif event == SD_READ_END:
+                emit(tid, ph='E', ts=t, args={'read': arg})
+            elif event == SD_SYNC_BEGIN:
+                emit(tid, ph='B', ts=t, name='SD sync')
+            elif event == SD_SYNC_END:
+                emit(tid, ph='E', ts=t)
+            elif event == TX_START:
+                tx_id += 1
+                tx_name = can_id(arg)
+                emit(BUS_TID, ph='b', ts=t, cat='can', id=tx_id, name=tx_name)
+            elif event == TX_FREE and tx_name:
+                emit(BUS_TID, ph='e', ts=t, cat='can', id=tx_id, name=tx_name)
+                tx_name = None
+        for task in open_run:
+            emit(task + 1, ph='E', ts=t)
+
+    for tid in sorted(tids):
+        if tid >= BUS_TID:
+            name = 'CAN TX pending'
+        elif tid >= CORE_TID:
+            name = f'core {tid - CORE_TID}'
+        elif tid >= ISR_TID:
+            name = f'core {tid - ISR_TID} ISR'
+        else:
+            name = TASK_NAMES[tid - 1] if tid - 1 < len(TASK_NAMES) else f'task {tid - 1}'
+        events.append({'ph': 'M', 'pid': 0, 'tid': tid, 'name': 'thread_name', 'args': {'name': name}})
+    return events
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a "trace" serial dump to Chrome trace / Perfetto JSON.')
+    parser.add_argument('input', help='Serial capture containing the output of the "trace" command')
+    parser.add_argument('output', help='Output JSON filename')
+
+    args = parser.parse_args()
+
+    try:
+        dump = read_dump(args.input)
+    except FileNotFoundError:
+        print(f"Error: File {args.input} not found.", file=sys.stderr)
+        sys.exit(1)
+
+    if dump is None:
+        print("Error: No complete trace dump found.", file=sys.stderr)
+        sys.exit(1)
+
+    now_us, cores = dump
+    events = convert(now_us, cores)
+    with open(args.output, 'w') as f:
+        json.dump({'traceEvents': events, 'displayTimeUnit': 'ms'}, f)
+    print(f"Converted {sum(len(r) for r in cores.values())} events to {args.output}")
+
+if __name__ == "__main__":
+    main()